@@ -0,0 +1,230 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonCbor.h>
+
+#include <QJsonArray>
+
+#include <cmath>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Same nesting limit as QJsonStreamReader, so a hostile file can't overflow the stack */
+static const int MaxDepth = 1024;
+
+static void writeObject(QCborStreamWriter& writer, const QJsonObject& json);
+
+static void writeValue(QCborStreamWriter& writer, const QJsonValue& value)
+{
+	switch (value.type())
+	{
+	case QJsonValue::Bool:
+		writer.append(value.toBool());
+		break;
+	case QJsonValue::Double:
+	{
+		// Integral doubles are written as CBOR integers, way more compact
+		const double number = value.toDouble();
+		if (number >= -9007199254740992.0 && number <= 9007199254740992.0 && number == std::floor(number) && !(number == 0 && std::signbit(number)))
+			writer.append(qint64(number));
+		else
+			writer.append(number);
+		break;
+	}
+	case QJsonValue::String:
+		writer.append(value.toString());
+		break;
+	case QJsonValue::Array:
+	{
+		const QJsonArray array = value.toArray();
+		writer.startArray(quint64(array.size()));
+		for (const QJsonValue& element : array)
+			writeValue(writer, element);
+		writer.endArray();
+		break;
+	}
+	case QJsonValue::Object:
+		writeObject(writer, value.toObject());
+		break;
+	default:
+		writer.append(nullptr);
+		break;
+	}
+}
+
+static void writeObject(QCborStreamWriter& writer, const QJsonObject& json)
+{
+	writer.startMap(quint64(json.size()));
+	for (auto it = json.constBegin(); it != json.constEnd(); ++it)
+	{
+		writer.append(it.key());
+		writeValue(writer, it.value());
+	}
+	writer.endMap();
+}
+
+static bool readString(QCborStreamReader& reader, QString& string)
+{
+	string.clear();
+	QCborStreamReader::StringResult<QString> chunk = reader.readString();
+	while (chunk.status == QCborStreamReader::Ok)
+	{
+		string += chunk.data;
+		chunk = reader.readString();
+	}
+	return chunk.status == QCborStreamReader::EndOfString;
+}
+
+static bool readByteArray(QCborStreamReader& reader, QByteArray& bytes)
+{
+	bytes.clear();
+	QCborStreamReader::StringResult<QByteArray> chunk = reader.readByteArray();
+	while (chunk.status == QCborStreamReader::Ok)
+	{
+		bytes += chunk.data;
+		chunk = reader.readByteArray();
+	}
+	return chunk.status == QCborStreamReader::EndOfString;
+}
+
+static bool readMap(QCborStreamReader& reader, QJsonObject& json, const int depth);
+
+/** depth is the number of containers and tags around the value */
+static bool readValue(QCborStreamReader& reader, QJsonValue& value, const int depth)
+{
+	if (depth >= MaxDepth)
+		return false;
+
+	switch (reader.type())
+	{
+	case QCborStreamReader::UnsignedInteger:
+		value = double(reader.toUnsignedInteger());
+		return reader.next();
+	case QCborStreamReader::NegativeInteger:
+		// Absolute value is stored, -1 is 1
+		value = -double(quint64(reader.toNegativeInteger()));
+		return reader.next();
+	case QCborStreamReader::Float16:
+		value = double(float(reader.toFloat16()));
+		return reader.next();
+	case QCborStreamReader::Float:
+		value = double(reader.toFloat());
+		return reader.next();
+	case QCborStreamReader::Double:
+		value = reader.toDouble();
+		return reader.next();
+	case QCborStreamReader::SimpleType:
+		if (reader.isBool())
+			value = reader.toBool();
+		else
+			value = QJsonValue(QJsonValue::Null);
+		return reader.next();
+	case QCborStreamReader::String:
+	{
+		QString string;
+		if (!readString(reader, string))
+			return false;
+		value = string;
+		return true;
+	}
+	case QCborStreamReader::ByteArray:
+	{
+		QByteArray bytes;
+		if (!readByteArray(reader, bytes))
+			return false;
+		value = QString::fromLatin1(bytes.toBase64(QByteArray::Base64UrlEncoding | QByteArray::OmitTrailingEquals));
+		return true;
+	}
+	case QCborStreamReader::Array:
+	{
+		if (!reader.enterContainer())
+			return false;
+		QJsonArray array;
+		while (reader.hasNext())
+		{
+			QJsonValue element;
+			if (!readValue(reader, element, depth + 1))
+				return false;
+			array.append(element);
+		}
+		value = array;
+		return reader.leaveContainer();
+	}
+	case QCborStreamReader::Map:
+	{
+		QJsonObject object;
+		if (!readMap(reader, object, depth))
+			return false;
+		value = object;
+		return true;
+	}
+	case QCborStreamReader::Tag:
+		// Tags don't exist in json, only the tagged value is kept
+		return reader.next() && readValue(reader, value, depth + 1);
+	default:
+		return false;
+	}
+}
+
+static bool readMap(QCborStreamReader& reader, QJsonObject& json, const int depth)
+{
+	if (!reader.isMap() || !reader.enterContainer())
+		return false;
+
+	while (reader.hasNext())
+	{
+		QString key;
+		if (reader.isString())
+		{
+			if (!readString(reader, key))
+				return false;
+		}
+		else if (reader.isInteger())
+		{
+			key = QString::number(reader.toInteger());
+			if (!reader.next())
+				return false;
+		}
+		else
+			return false;
+
+		QJsonValue value;
+		if (!readValue(reader, value, depth + 1))
+			return false;
+		json.insert(key, value);
+	}
+	return reader.leaveContainer();
+}
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+void QJsonCbor::write(QCborStreamWriter& writer, const QJsonObject& json)
+{
+	writeObject(writer, json);
+}
+
+QByteArray QJsonCbor::toCbor(const QJsonObject& json)
+{
+	QByteArray data;
+	QCborStreamWriter writer(&data);
+	write(writer, json);
+	return data;
+}
+
+bool QJsonCbor::read(QCborStreamReader& reader, QJsonObject& json)
+{
+	return readMap(reader, json, 0) && reader.lastError() == QCborError::NoError;
+}
+
+bool QJsonCbor::fromCbor(const QByteArray& data, QJsonObject& json)
+{
+	QCborStreamReader reader(data);
+	return read(reader, json);
+}
@@ -0,0 +1,56 @@
+/**
+ * \file QJsonCbor.h
+ * \brief Streaming conversion between json objects and CBOR
+ */
+#ifndef __QJSON_CBOR_HPP__
+#define __QJSON_CBOR_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+
+// Qt Header
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
+#include <QJsonObject>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Convert json objects to and from CBOR token by token.
+ * No intermediate QCborValue tree is built.
+ */
+class QSUPERMACROS_API_ QJsonCbor
+{
+public:
+	/** Write json as a CBOR map */
+	static void write(QCborStreamWriter& writer, const QJsonObject& json);
+	/** Serialize json as a CBOR map */
+	static QByteArray toCbor(const QJsonObject& json);
+
+	/**
+	 * Read a CBOR map into json. Byte strings are converted to base64url like QCborValue::toJsonValue().
+	 * Containers and tags nested deeper than 1024 levels are rejected.
+	 * \return false if data isn't a valid map
+	 */
+	static bool read(QCborStreamReader& reader, QJsonObject& json);
+	/** Parse a CBOR map. \return false if data isn't a valid map */
+	static bool fromCbor(const QByteArray& data, QJsonObject& json);
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
@@ -0,0 +1,178 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonCompressedDevice.h>
+
+#include <QtEndian>
+
+#include <cstring>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+static const char Magic[] = "QSMZ";
+
+/** Refuse blocks way bigger than what is written, so a corrupted size can't exhaust the memory */
+static const quint32 MaxCompressedBlockSize = 64 * 1024 * 1024;
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+QJsonCompressedDevice::QJsonCompressedDevice(QIODevice* device, const quint8 format, const int level) :
+	_device(device),
+	_format(format),
+	_level(level)
+{
+}
+
+QJsonCompressedDevice::~QJsonCompressedDevice()
+{
+	if (isOpen())
+		close();
+}
+
+bool QJsonCompressedDevice::open(OpenMode mode)
+{
+	const OpenMode access = mode & ReadWrite;
+	if (!_device || (access != ReadOnly && access != WriteOnly))
+		return false;
+
+	_block.resize(0);
+	_blockPos = 0;
+	_ended = false;
+	_error = false;
+
+	char header[HeaderSize];
+	if (access == ReadOnly)
+	{
+		if (_device->read(header, HeaderSize) != HeaderSize || std::memcmp(header, Magic, 4) != 0 ||
+			quint8(header[4]) != Version || quint8(header[5]) != Zlib)
+		{
+			_error = true;
+			return false;
+		}
+		_format = quint8(header[6]);
+	}
+	else
+	{
+		std::memcpy(header, Magic, 4);
+		header[4] = char(Version);
+		header[5] = char(Zlib);
+		header[6] = char(_format);
+		header[7] = 0;
+		if (_device->write(header, HeaderSize) != HeaderSize)
+		{
+			_error = true;
+			return false;
+		}
+		_block.reserve(BlockSize);
+	}
+
+	// Data is already buffered block by block
+	return QIODevice::open(mode | Unbuffered);
+}
+
+void QJsonCompressedDevice::close()
+{
+	if (openMode() & WriteOnly)
+	{
+		if (!_block.isEmpty())
+			writeBlock();
+		const uchar end[4] = { 0, 0, 0, 0 };
+		if (_device->write(reinterpret_cast<const char*>(end), 4) != 4)
+			setError();
+	}
+	_block.clear();
+	QIODevice::close();
+}
+
+bool QJsonCompressedDevice::isCompressed(const QByteArray& data)
+{
+	return data.startsWith(Magic);
+}
+
+qint64 QJsonCompressedDevice::readData(char* data, qint64 maxSize)
+{
+	qint64 total = 0;
+	while (total < maxSize)
+	{
+		if (_blockPos == _block.size())
+		{
+			if (_ended || _error || !readBlock())
+				break;
+			continue;
+		}
+		const qint64 count = qMin(maxSize - total, qint64(_block.size() - _blockPos));
+		std::memcpy(data + total, _block.constData() + _blockPos, size_t(count));
+		_blockPos += int(count);
+		total += count;
+	}
+	if (total > 0)
+		return total;
+	return _ended || _error ? -1 : 0;
+}
+
+qint64 QJsonCompressedDevice::writeData(const char* data, qint64 size)
+{
+	qint64 written = 0;
+	while (written < size)
+	{
+		const int count = int(qMin(size - written, qint64(BlockSize - _block.size())));
+		_block.append(data + written, count);
+		written += count;
+		if (_block.size() == BlockSize && !writeBlock())
+			return -1;
+	}
+	return written;
+}
+
+bool QJsonCompressedDevice::readBlock()
+{
+	uchar sizeData[4];
+	if (_device->read(reinterpret_cast<char*>(sizeData), 4) != 4)
+		return setError();
+
+	const quint32 compressedSize = qFromBigEndian<quint32>(sizeData);
+	if (compressedSize == 0)
+	{
+		_ended = true;
+		return false;
+	}
+	if (compressedSize > MaxCompressedBlockSize)
+		return setError();
+
+	const QByteArray compressed = _device->read(compressedSize);
+	if (compressed.size() != int(compressedSize))
+		return setError();
+	// qUncompress allocate the size announced by the block, only writeBlock() sizes are trusted
+	if (compressedSize < 4 || qFromBigEndian<quint32>(reinterpret_cast<const uchar*>(compressed.constData())) > quint32(BlockSize))
+		return setError();
+
+	_block = qUncompress(compressed);
+	_blockPos = 0;
+	return !_block.isEmpty() || setError();
+}
+
+bool QJsonCompressedDevice::writeBlock()
+{
+	const QByteArray compressed = qCompress(_block, _level);
+	_block.resize(0);
+
+	uchar sizeData[4];
+	qToBigEndian<quint32>(quint32(compressed.size()), sizeData);
+	if (_device->write(reinterpret_cast<const char*>(sizeData), 4) != 4 || _device->write(compressed) != compressed.size())
+		return setError();
+	return true;
+}
+
+bool QJsonCompressedDevice::setError()
+{
+	_error = true;
+	setErrorString(QStringLiteral("Corrupted compressed data or device error"));
+	return false;
+}
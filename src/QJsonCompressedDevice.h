@@ -0,0 +1,99 @@
+/**
+ * \file QJsonCompressedDevice.h
+ * \brief Block compressed file device
+ */
+#ifndef __QJSON_COMPRESSED_DEVICE_HPP__
+#define __QJSON_COMPRESSED_DEVICE_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+
+// Qt Header
+#include <QByteArray>
+#include <QIODevice>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Sequential device that compress what is written to an other device, and inflate what is read from it.
+ * Data is cut in blocks that are compressed independently, so reading never hold more than one block in memory.
+ *
+ * File layout, integers are big endian:
+ * * Header : "QSMZ", version (1 byte), codec (1 byte), format of the content (1 byte), reserved (1 byte)
+ * * Blocks : compressed size (4 bytes), then the compressed block
+ * * End : a block with a compressed size of 0
+ */
+class QSUPERMACROS_API_ QJsonCompressedDevice : public QIODevice
+{
+public:
+	/** Compression of the blocks */
+	enum Codec : quint8
+	{
+		/** qCompress() zlib stream */
+		Zlib = 1
+	};
+
+	/**
+	 * Compress to or inflate from device, which must be open.
+	 * format is stored as is in the header when writing. level is the zlib level, -1 for the default.
+	 */
+	explicit QJsonCompressedDevice(QIODevice* device, const quint8 format = 0, const int level = -1);
+	/** Write the last block if still open */
+	~QJsonCompressedDevice();
+
+public:
+	/** Open ReadOnly or WriteOnly. Read or write the header. \return false if the header is invalid */
+	bool open(OpenMode mode) override;
+	/** Write the last block and the end marker when writing */
+	void close() override;
+	bool isSequential() const override { return true; }
+
+	/** Format of the content, read from the header once opened in read mode */
+	quint8 format() const { return _format; }
+	/** True if the underlying device failed or the data is corrupted */
+	bool hasError() const { return _error; }
+	/** True if data start with a compressed header */
+	static bool isCompressed(const QByteArray& data);
+
+protected:
+	qint64 readData(char* data, qint64 maxSize) override;
+	qint64 writeData(const char* data, qint64 size) override;
+
+private:
+	Q_DISABLE_COPY(QJsonCompressedDevice)
+
+	static const int BlockSize = 256 * 1024;
+	static const int HeaderSize = 8;
+	static const quint8 Version = 1;
+
+	bool readBlock();
+	bool writeBlock();
+	bool setError();
+
+private:
+	QIODevice* _device = nullptr;
+	quint8 _format = 0;
+	int _level = -1;
+	QByteArray _block;
+	int _blockPos = 0;
+	bool _ended = false;
+	bool _error = false;
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
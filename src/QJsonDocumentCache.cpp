@@ -0,0 +1,130 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonDocumentCache.h>
+
+#include <QCache>
+#include <QDateTime>
+#include <QMutex>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Document parsed from a file in a given state */
+struct CachedDocument
+{
+	qint64 modified;
+	qint64 size;
+	QJsonObject json;
+};
+
+struct DocumentCache
+{
+	QMutex mutex;
+	QCache<QString, CachedDocument> documents{ 16 * 1024 * 1024 };
+	quint64 hits = 0;
+	quint64 misses = 0;
+};
+
+static DocumentCache& documentCache()
+{
+	static DocumentCache cache;
+	return cache;
+}
+
+/**
+ * Files written less than this before their parse aren't cached. Filesystems with a coarse modification time
+ * (FAT, some network shares) could otherwise see a second write in the same tick keep the size and mtime of the cached state
+ */
+static const qint64 RacyWindowMs = 2000;
+
+/** One entry per file and format, a newer state of the file replace the old one */
+static QString cacheKey(const QFileInfo& file, const int format)
+{
+	return file.canonicalFilePath() + QLatin1Char('#') + QString::number(format);
+}
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+bool QJsonDocumentCache::find(const QFileInfo& file, const int format, QJsonObject& json)
+{
+	DocumentCache& cache = documentCache();
+	QMutexLocker lock(&cache.mutex);
+	if (!cache.documents.maxCost())
+		return false;
+
+	const CachedDocument* document = cache.documents.object(cacheKey(file, format));
+	if (!document || document->size != file.size() || document->modified != file.lastModified().toMSecsSinceEpoch())
+	{
+		++cache.misses;
+		return false;
+	}
+
+	++cache.hits;
+	json = document->json;
+	return true;
+}
+
+void QJsonDocumentCache::insert(const QFileInfo& file, const int format, const QJsonObject& json)
+{
+	DocumentCache& cache = documentCache();
+	QMutexLocker lock(&cache.mutex);
+	if (!cache.documents.maxCost() || !file.exists() || file.size() > cache.documents.maxCost())
+		return;
+
+	const qint64 modified = file.lastModified().toMSecsSinceEpoch();
+	if (QDateTime::currentMSecsSinceEpoch() - modified < RacyWindowMs)
+		return;
+
+	const int cost = qMax(1, int(file.size()));
+	cache.documents.insert(cacheKey(file, format), new CachedDocument{ modified, file.size(), json }, cost);
+}
+
+void QJsonDocumentCache::setMaxCost(const int bytes)
+{
+	DocumentCache& cache = documentCache();
+	QMutexLocker lock(&cache.mutex);
+	cache.documents.setMaxCost(qMax(0, bytes));
+}
+
+int QJsonDocumentCache::maxCost()
+{
+	DocumentCache& cache = documentCache();
+	QMutexLocker lock(&cache.mutex);
+	return cache.documents.maxCost();
+}
+
+void QJsonDocumentCache::clear()
+{
+	DocumentCache& cache = documentCache();
+	QMutexLocker lock(&cache.mutex);
+	cache.documents.clear();
+}
+
+quint64 QJsonDocumentCache::hits()
+{
+	DocumentCache& cache = documentCache();
+	QMutexLocker lock(&cache.mutex);
+	return cache.hits;
+}
+
+quint64 QJsonDocumentCache::misses()
+{
+	DocumentCache& cache = documentCache();
+	QMutexLocker lock(&cache.mutex);
+	return cache.misses;
+}
+
+void QJsonDocumentCache::resetCounters()
+{
+	DocumentCache& cache = documentCache();
+	QMutexLocker lock(&cache.mutex);
+	cache.hits = 0;
+	cache.misses = 0;
+}
@@ -0,0 +1,63 @@
+/**
+ * \file QJsonDocumentCache.h
+ * \brief Process wide cache of parsed json files
+ */
+#ifndef __QJSON_DOCUMENT_CACHE_HPP__
+#define __QJSON_DOCUMENT_CACHE_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+
+// Qt Header
+#include <QFileInfo>
+#include <QJsonObject>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Least recently used cache of the documents parsed by QJsonImportable::dataLoad(), ie jsonLoad(), binaryLoad() and cborLoad().
+ * Entries are keyed by canonical path and format, and are only valid while the file keep its modification time and size,
+ * so a file is parsed once per change instead of once per consumer.
+ * The content isn't compared: a file rewritten with the same size within the modification time resolution of its filesystem
+ * would be served stale. Files modified in the last 2 seconds aren't cached to cover coarse filesystems like FAT.
+ * The cost of an entry is the size of its file, bounded by maxCost(). Thread safe.
+ */
+class QSUPERMACROS_API_ QJsonDocumentCache
+{
+public:
+	/** Find the document of file parsed in format. \return false on a miss */
+	static bool find(const QFileInfo& file, const int format, QJsonObject& json);
+	/** Store the document of file parsed in format. File bigger than maxCost() or modified in the last 2 seconds aren't stored */
+	static void insert(const QFileInfo& file, const int format, const QJsonObject& json);
+
+	/** Total size of the cached files, in bytes. 0 disable the cache. Default to 16 MiB */
+	static void setMaxCost(const int bytes);
+	static int maxCost();
+	/** Remove every entry, counters are kept */
+	static void clear();
+
+	/** Number of find() that returned a document */
+	static quint64 hits();
+	/** Number of find() that didn't */
+	static quint64 misses();
+	/** Reset hits() and misses() to 0 */
+	static void resetCounters();
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
@@ -0,0 +1,210 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonHotReload.h>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QFutureWatcher>
+#include <QJsonDocument>
+#include <QTimer>
+#include <QtConcurrent>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Read and parse filepath. \return false if it can't be read or isn't a json object */
+static bool readObject(const QString& filepath, QJsonObject& json)
+{
+	QFile file(filepath);
+	if (!file.open(QIODevice::ReadOnly))
+		return false;
+
+	QJsonParseError error;
+	const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+	if (error.error != QJsonParseError::NoError || !document.isObject())
+		return false;
+	json = document.object();
+	return true;
+}
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+QJsonHotReload::QJsonHotReload(QJsonImportable* importable, const int debounceMs) :
+	_importable(importable),
+	_watcher(new QFileSystemWatcher),
+	_debounce(new QTimer),
+	_reload(new QFutureWatcher<Reload>)
+{
+	_debounce->setSingleShot(true);
+	_debounce->setInterval(debounceMs);
+
+	// Watcher, timer and future watcher are owned by this, so are the connections
+	QObject::connect(_watcher.data(), &QFileSystemWatcher::fileChanged, _watcher.data(), [this](const QString&) { fileChanged(); });
+	QObject::connect(_watcher.data(), &QFileSystemWatcher::directoryChanged, _watcher.data(), [this](const QString&) { directoryChanged(); });
+	QObject::connect(_debounce.data(), &QTimer::timeout, _debounce.data(), [this]() { startReload(); });
+	QObject::connect(_reload.data(), &QFutureWatcherBase::finished, _reload.data(), [this]() { applyReload(); });
+}
+
+QJsonHotReload::~QJsonHotReload()
+{
+	stop();
+	// The parse keep running in the pool, its result is discarded with the future watcher
+	_reload->disconnect();
+}
+
+bool QJsonHotReload::watch(const QUrl& filepath)
+{
+	stop();
+
+	QJsonObject document;
+	const QString path = filepath.toLocalFile();
+	// Stat before reading, a change during the read is seen as a new change
+	const QFileInfo info(path);
+	if (!_importable || !readObject(path, document))
+	{
+		qWarning("Couldn't load Json file to watch.");
+		return false;
+	}
+
+	_importable->jsonRead(document);
+	_document = document;
+	_fileSize = info.size();
+	_fileModified = info.lastModified();
+	_filepath = path;
+
+	// The directory tell when the file is replaced by a rename
+	_watcher->addPath(path);
+	_watcher->addPath(QFileInfo(path).absolutePath());
+	return true;
+}
+
+void QJsonHotReload::stop()
+{
+	const QStringList files = _watcher->files();
+	const QStringList directories = _watcher->directories();
+	if (!files.isEmpty())
+		_watcher->removePaths(files);
+	if (!directories.isEmpty())
+		_watcher->removePaths(directories);
+
+	_debounce->stop();
+	_pending = false;
+	_filepath.clear();
+	_document = QJsonObject();
+	_fileSize = -1;
+	_fileModified = QDateTime();
+}
+
+bool QJsonHotReload::isWatching() const
+{
+	return !_filepath.isEmpty();
+}
+
+void QJsonHotReload::fileChanged()
+{
+	if (_filepath.isEmpty())
+		return;
+
+	// A file replaced by a rename is a new file, that isn't watched anymore
+	if (!_watcher->files().contains(_filepath) && QFileInfo::exists(_filepath))
+		_watcher->addPath(_filepath);
+
+	_debounce->start();
+}
+
+void QJsonHotReload::directoryChanged()
+{
+	if (_filepath.isEmpty())
+		return;
+
+	// An other file of the directory changed
+	const QFileInfo info(_filepath);
+	if (_watcher->files().contains(_filepath) && info.exists() && info.size() == _fileSize && info.lastModified() == _fileModified)
+		return;
+
+	fileChanged();
+}
+
+void QJsonHotReload::startReload()
+{
+	if (_reload->isRunning())
+	{
+		_pending = true;
+		return;
+	}
+
+	const QString path = _filepath;
+	const QJsonObject previous = _document;
+	_reload->setFuture(QtConcurrent::run([path, previous]() -> Reload
+	{
+		const QFileInfo info(path);
+		Reload reload{ path, false, info.size(), info.lastModified(), QJsonObject(), QJsonObject() };
+		reload.parsed = readObject(path, reload.document);
+		if (reload.parsed)
+			reload.diff = diff(previous, reload.document);
+		return reload;
+	}));
+}
+
+void QJsonHotReload::applyReload()
+{
+	const Reload reload = _reload->result();
+
+	// Stopped or watching an other file meanwhile
+	if (reload.filepath != _filepath || !_importable)
+		return;
+
+	if (reload.parsed)
+	{
+		_document = reload.document;
+		_fileSize = reload.size;
+		_fileModified = reload.modified;
+	}
+	if (reload.parsed && !reload.diff.isEmpty())
+	{
+		_importable->jsonReadPatch(reload.diff, reload.document);
+		++_reloadCount;
+		if (_reloaded)
+			_reloaded(reload.diff);
+	}
+
+	if (_pending)
+	{
+		_pending = false;
+		_debounce->start();
+	}
+}
+
+QJsonObject QJsonHotReload::diff(const QJsonObject& previous, const QJsonObject& current)
+{
+	QJsonObject changes;
+	for (auto it = current.constBegin(); it != current.constEnd(); ++it)
+	{
+		const auto old = previous.constFind(it.key());
+		if (old == previous.constEnd())
+		{
+			changes.insert(it.key(), it.value());
+			continue;
+		}
+		if (old.value() == it.value())
+			continue;
+
+		if (old.value().isObject() && it.value().isObject())
+		{
+			const QJsonObject nested = diff(old.value().toObject(), it.value().toObject());
+			if (!nested.isEmpty())
+				changes.insert(it.key(), nested);
+		}
+		else
+			changes.insert(it.key(), it.value());
+	}
+	return changes;
+}
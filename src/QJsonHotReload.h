@@ -0,0 +1,124 @@
+/**
+ * \file QJsonHotReload.h
+ * \brief Reload a json file when it change, applying only what changed
+ */
+#ifndef __QJSON_HOT_RELOAD_HPP__
+#define __QJSON_HOT_RELOAD_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+#include <functional>
+
+// Qt Header
+#include <QDateTime>
+#include <QJsonObject>
+#include <QScopedPointer>
+#include <QString>
+#include <QUrl>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+#include <QJsonImportExport.h>
+
+QT_BEGIN_NAMESPACE
+class QFileSystemWatcher;
+class QTimer;
+template<typename T> class QFutureWatcher;
+QT_END_NAMESPACE
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Watch a json file and reload it in an importable when it change.
+ * Changes are debounced, the file is read, parsed and diffed against the last loaded document in the global thread pool,
+ * then QJsonImportable::jsonReadPatch() is called in the thread of the reloader with the members that changed
+ * and the new document. Its default implementation read the whole document, override it to call the setters
+ * of the changed values only.
+ *
+ * * Nested objects are diffed recursively, arrays and scalars are replaced as a whole.
+ * * Removed members aren't in the diff, only in the document.
+ * * A file that doesn't parse, ie while it's being written, is ignored until its next change.
+ * * Files replaced by a rename, like editors and atomic saves do, keep being watched.
+ * * Changes of other files of the directory are ignored, as long as the file keep its size and modification time.
+ *
+ * The reloader and the importable must live in the same thread, which must run an event loop.
+ *
+ * \code
+ * QJsonHotReload reload(&settings);
+ * reload.watch(QUrl::fromLocalFile(path));
+ * \endcode
+ */
+class QSUPERMACROS_API_ QJsonHotReload
+{
+public:
+	/** Reload in importable, debounceMs after the last change of the file */
+	explicit QJsonHotReload(QJsonImportable* importable, const int debounceMs = 200);
+	/** Stop watching. A reload in flight is dropped */
+	~QJsonHotReload();
+
+public:
+	/** Load the whole filepath in the importable now, then reload it on every change. \return false if the first load failed */
+	bool watch(const QUrl& filepath);
+	/** Stop watching the file */
+	void stop();
+	/** True while a file is watched */
+	bool isWatching() const;
+
+	/** Called after each reload, with the members that were applied. Not called if nothing changed */
+	void setReloadedCallback(const std::function<void(const QJsonObject& diff)>& callback) { _reloaded = callback; }
+	/** Number of reloads that changed something */
+	int reloadCount() const { return _reloadCount; }
+
+	/**
+	 * Members of current that aren't in previous or have a different value.
+	 * Objects present in both are diffed recursively, and only kept if something changed inside.
+	 */
+	static QJsonObject diff(const QJsonObject& previous, const QJsonObject& current);
+
+private:
+	Q_DISABLE_COPY(QJsonHotReload)
+
+	struct Reload
+	{
+		QString filepath;
+		bool parsed;
+		qint64 size;
+		QDateTime modified;
+		QJsonObject document;
+		QJsonObject diff;
+	};
+
+	void fileChanged();
+	void directoryChanged();
+	void startReload();
+	void applyReload();
+
+private:
+	QJsonImportable* _importable = nullptr;
+	QString _filepath;
+	QJsonObject _document;
+	/** Size and modification time of the file when _document was read */
+	qint64 _fileSize = -1;
+	QDateTime _fileModified;
+	QScopedPointer<QFileSystemWatcher> _watcher;
+	QScopedPointer<QTimer> _debounce;
+	QScopedPointer<QFutureWatcher<Reload>> _reload;
+	std::function<void(const QJsonObject& diff)> _reloaded;
+	int _reloadCount = 0;
+	bool _pending = false;
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
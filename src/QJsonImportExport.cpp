@@ -3,6 +3,31 @@
 // ─────────────────────────────────────────────────────────────
 
 #include <QJsonImportExport.h>
+#include <QJsonCbor.h>
+#include <QJsonDocumentCache.h>
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QFutureInterface>
+#include <QHash>
+#include <QMutex>
+#include <QSaveFile>
+#include <QScopedPointer>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 // ─────────────────────────────────────────────────────────────
 //					DECLARATION
@@ -10,26 +35,561 @@
 
 QSUPERMACROS_USING_NAMESPACE;
 
+/** Save requested with dataSaveAsync(), waiting for its file to be free */
+struct PendingSave
+{
+	QJsonObject snapshot;
+	QJsonFileFormat format = QJsonFileFormat::Json;
+	QJsonExportable::SaveMode mode = QJsonExportable::SaveMode::InPlace;
+	QJsonExportable::SaveSync sync = QJsonExportable::SaveSync::NoSync;
+	QFutureInterface<bool> result;
+};
+
+/** Shared between an exportable and its in-flight saves */
+struct QJsonExportable::AsyncSave
+{
+	QMutex mutex;
+	/** Saves not started yet, by file. A file has an entry while a worker write it */
+	QHash<QString, QList<QSharedPointer<PendingSave>>> queues;
+};
+
+/** Last payload written, to skip unchanged saves */
+struct QJsonExportable::SavedPayload
+{
+	QMutex mutex;
+	bool valid = false;
+	bool written = false;
+	QString filepath;
+	quint64 hash = 0;
+	qint64 size = 0;
+	/** Modification time of the file right after the write, an other writer keeping the size change it */
+	QDateTime modified;
+};
+
+static QJsonFileFormat fileFormat(const bool fromJson)
+{
+	return fromJson ? QJsonFileFormat::Json : QJsonFileFormat::Binary;
+}
+
+static QByteArray serializeDocument(const QJsonObject& jsonObject, const QJsonFileFormat format)
+{
+	switch (format)
+	{
+	case QJsonFileFormat::Json:
+		return QJsonDocument(jsonObject).toJson();
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+	case QJsonFileFormat::Binary:
+		QT_WARNING_PUSH
+		QT_WARNING_DISABLE_DEPRECATED
+		return QJsonDocument(jsonObject).toBinaryData();
+		QT_WARNING_POP
+#endif
+	default:
+		return QJsonCbor::toCbor(jsonObject);
+	}
+}
+
+/** Legacy binary json files start with this tag */
+static bool isBinaryJson(const QByteArray& data)
+{
+	return data.startsWith("qbjs");
+}
+
+/** Parse data in format. Binary and Cbor both accept legacy binary json and CBOR, the tag tell them apart */
+static bool parseDocument(const QByteArray& data, const QJsonFileFormat format, QJsonObject& jsonObject)
+{
+	if (format == QJsonFileFormat::Json)
+	{
+		QJsonParseError error;
+		const QJsonDocument document = QJsonDocument::fromJson(data, &error);
+		if (document.isNull())
+		{
+			qWarning("Couldn't parse Json file : %s", qPrintable(error.errorString()));
+			return false;
+		}
+		jsonObject = document.object();
+		return true;
+	}
+
+	if (isBinaryJson(data))
+	{
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+		QT_WARNING_PUSH
+		QT_WARNING_DISABLE_DEPRECATED
+		const QJsonDocument document = QJsonDocument::fromBinaryData(data);
+		QT_WARNING_POP
+		if (!document.isNull())
+		{
+			jsonObject = document.object();
+			return true;
+		}
+#endif
+		qWarning("Couldn't parse Json file : invalid binary data");
+		return false;
+	}
+
+	if (!QJsonCbor::fromCbor(data, jsonObject))
+	{
+		qWarning("Couldn't parse Json file : invalid CBOR data");
+		return false;
+	}
+	return true;
+}
+
+/** Flush file buffers then the OS cache down to the disk */
+static bool syncFile(QFileDevice& file)
+{
+	if (!file.flush())
+		return false;
+	const int handle = file.handle();
+#ifdef Q_OS_WIN
+	return handle < 0 || ::_commit(handle) == 0;
+#else
+	return handle >= 0 && ::fsync(handle) == 0;
+#endif
+}
+
+/** Flush the directory entry of filepath, so a rename survive a power loss */
+static bool syncDirectory(const QString& filepath)
+{
+#ifdef Q_OS_WIN
+	// Directories can't be flushed on Windows, NTFS journal the rename itself
+	Q_UNUSED(filepath);
+	return true;
+#else
+	const QByteArray directory = QFile::encodeName(QFileInfo(filepath).absolutePath());
+	const int handle = ::open(directory.constData(), O_RDONLY);
+	if (handle < 0)
+		return false;
+	const bool synced = ::fsync(handle) == 0;
+	::close(handle);
+	return synced;
+#endif
+}
+
+/** Open filepath according to mode, let write fill it, then sync and commit. \return false if anything failed */
+static bool writeFile(const QString& filepath, const std::function<bool(QIODevice&)>& write, const QJsonExportable::SaveMode mode, const QJsonExportable::SaveSync sync)
+{
+	const bool atomic = mode == QJsonExportable::SaveMode::Atomic;
+	QScopedPointer<QFileDevice> saveFile(atomic ? static_cast<QFileDevice*>(new QSaveFile(filepath)) : new QFile(filepath));
+
+	if (!saveFile->open(QIODevice::WriteOnly))
+	{
+		qWarning("Couldn't open Json save file.");
+		return false;
+	}
+
+	// An uncommitted QSaveFile is discarded, the previous file is left untouched. Its commit already fsync the file
+	if (!write(*saveFile) || (!atomic && sync != QJsonExportable::SaveSync::NoSync && !syncFile(*saveFile)))
+	{
+		qWarning("Couldn't write Json save file : %s", qPrintable(saveFile->errorString()));
+		return false;
+	}
+
+	if (atomic && !static_cast<QSaveFile*>(saveFile.data())->commit())
+	{
+		qWarning("Couldn't commit Json save file : %s", qPrintable(saveFile->errorString()));
+		return false;
+	}
+
+	if (sync == QJsonExportable::SaveSync::SyncFileAndDirectory && !syncDirectory(filepath))
+	{
+		qWarning("Couldn't sync Json save file directory.");
+		return false;
+	}
+	return true;
+}
+
+static bool writeFile(const QString& filepath, const QByteArray& data, const QJsonExportable::SaveMode mode, const QJsonExportable::SaveSync sync)
+{
+	return writeFile(filepath, [&data](QIODevice& file)
+	{
+		return file.write(data) == data.size();
+	}, mode, sync);
+}
+
+static inline quint64 rotateLeft(const quint64 value, const int bits)
+{
+	return (value << bits) | (value >> (64 - bits));
+}
+
+/** Fast non cryptographic 64 bits hash, xxHash64 style with a single lane, 8 bytes per round */
+static quint64 payloadHash(const QByteArray& data)
+{
+	static const quint64 Prime1 = Q_UINT64_C(0x9E3779B185EBCA87);
+	static const quint64 Prime2 = Q_UINT64_C(0xC2B2AE3D27D4EB4F);
+	static const quint64 Prime3 = Q_UINT64_C(0x165667B19E3779F9);
+	static const quint64 Prime4 = Q_UINT64_C(0x85EBCA77C2B2AE63);
+
+	const char* it = data.constData();
+	const char* const end = it + data.size();
+	quint64 hash = Prime3 + quint64(data.size());
+
+	for (; end - it >= 8; it += 8)
+	{
+		quint64 word;
+		memcpy(&word, it, sizeof(word));
+		hash ^= rotateLeft(word * Prime2, 31) * Prime1;
+		hash = rotateLeft(hash, 27) * Prime1 + Prime4;
+	}
+	for (; it != end; ++it)
+	{
+		hash ^= quint64(uchar(*it)) * Prime3;
+		hash = rotateLeft(hash, 11) * Prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= Prime2;
+	hash ^= hash >> 29;
+	hash *= Prime3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+/**
+ * Map the whole file in memory so the parser read the pages directly.
+ * Sequential devices, empty or huge files can't be mapped.
+ * \return false if data must be read instead. data is only valid while file is open.
+ */
+static bool mapFileData(QFile& file, QByteArray& data)
+{
+	const qint64 size = file.size();
+	if (file.isSequential() || size <= 0 || size > std::numeric_limits<int>::max())
+		return false;
+
+	const uchar* mapped = file.map(0, size);
+	if (!mapped)
+		return false;
+
+	data = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), int(size));
+	return true;
+}
+
+/** Read and parse filepath, or take it from QJsonDocumentCache if it didn't change. \return false if the file can't be read or isn't valid */
+static bool readDocument(const QUrl& filepath, const QJsonFileFormat format, QJsonObject& jsonObject)
+{
+	// Stat before reading : if the file change meanwhile, the entry is stale and is replaced on next load
+	const QFileInfo info(filepath.toLocalFile());
+	if (QJsonDocumentCache::find(info, int(format), jsonObject))
+		return true;
+
+	QFile loadFile(filepath.toLocalFile());
+
+	if (!loadFile.open(QIODevice::ReadOnly))
+	{
+		qWarning("Couldn't open Json file to load.");
+		return false;
+	}
+
+	QByteArray saveData;
+	if (!mapFileData(loadFile, saveData))
+		saveData = loadFile.readAll();
+
+	if (!parseDocument(saveData, format, jsonObject))
+		return false;
+	QJsonDocumentCache::insert(info, int(format), jsonObject);
+	return true;
+}
+
+/** Call function in the thread of owner, main thread if owner is null. Block until done */
+static void runInOwnerThread(const QObject* owner, const std::function<void()>& function)
+{
+	if (!owner)
+		owner = QCoreApplication::instance();
+
+	if (!owner || owner->thread() == QThread::currentThread())
+		function();
+	else
+		QMetaObject::invokeMethod(const_cast<QObject*>(owner), function, Qt::BlockingQueuedConnection);
+}
+
+/** Map functor of QJsonImportable::jsonLoadAll */
+struct JsonFileLoader
+{
+	typedef bool result_type;
+
+	bool operator()(const QPair<QJsonImportable*, QUrl>& file) const
+	{
+		QJsonObject jsonObject;
+		if (!file.first || !readDocument(file.second, QJsonFileFormat::Json, jsonObject))
+			return false;
+
+		QJsonImportable* importable = file.first;
+		runInOwnerThread(dynamic_cast<const QObject*>(importable), [importable, &jsonObject]()
+		{
+			importable->jsonRead(jsonObject);
+		});
+		return true;
+	}
+};
+
+static bool streamLoad(QJsonImportable& importable, QJsonStreamReader& reader)
+{
+	if (reader.readNext() != QJsonStreamReader::StartObject || !importable.jsonStreamRead(reader) || reader.readNext() != QJsonStreamReader::EndDocument)
+	{
+		qWarning("Couldn't stream Json file : %s", qPrintable(reader.errorString()));
+		return false;
+	}
+	return true;
+}
+
+/** Biggest integer a double hold exactly */
+static const double MaxExactInteger = 9007199254740992.0;
+
+/** Parse the digits of [begin, end[ without any allocation. \return false if it isn't a number or it's bigger than max */
+static bool parseDigits(const QChar* begin, const QChar* end, const quint64 max, quint64& value)
+{
+	if (begin == end)
+		return false;
+
+	quint64 result = 0;
+	for (const QChar* it = begin; it != end; ++it)
+	{
+		const ushort c = it->unicode();
+		if (c < '0' || c > '9')
+			return false;
+		const quint64 digit = c - '0';
+		if (result > (max - digit) / 10)
+			return false;
+		result = result * 10 + digit;
+	}
+	value = result;
+	return true;
+}
+
+/** Narrow [begin, end[ to the string without surrounding spaces, like QString::toLongLong() */
+static void trimmed(const QChar*& begin, const QChar*& end)
+{
+	while (begin != end && begin->isSpace())
+		++begin;
+	while (end != begin && (end - 1)->isSpace())
+		--end;
+}
+
+static bool isExactInteger(const double number)
+{
+	return number >= -MaxExactInteger && number <= MaxExactInteger && number == std::floor(number);
+}
+
+/** Format value in a stack buffer, so the QString is the only allocation */
+static QString formatInteger(quint64 value, const bool negative)
+{
+	QChar digits[21];
+	int pos = 21;
+	do
+	{
+		digits[--pos] = QLatin1Char(char('0' + value % 10));
+		value /= 10;
+	} while (value);
+	if (negative)
+		digits[--pos] = QLatin1Char('-');
+	return QString(digits + pos, 21 - pos);
+}
+
 // ─────────────────────────────────────────────────────────────
 //					FUNCTIONS
 // ─────────────────────────────────────────────────────────────
 
-bool QJsonExportable::dataSave(const QUrl& filepath, const bool fromJson) const
+bool QSUPERMACROS_NAMESPACE::qJsonToInt64(const QJsonValue& json, qint64& value)
 {
-	QFile saveFile(filepath.toLocalFile());
-
-	if (!saveFile.open(QIODevice::WriteOnly))
+	if (json.isDouble())
 	{
-		qWarning("Couldn't open Json save file.");
+		const double number = json.toDouble();
+		if (!isExactInteger(number))
+			return false;
+		value = qint64(number);
+		return true;
+	}
+	if (!json.isString())
 		return false;
+
+	const QString string = json.toString();
+	const QChar* begin = string.constData();
+	const QChar* end = begin + string.size();
+	trimmed(begin, end);
+
+	const bool negative = begin != end && *begin == QLatin1Char('-');
+	if (begin != end && (negative || *begin == QLatin1Char('+')))
+		++begin;
+
+	const quint64 max = quint64(std::numeric_limits<qint64>::max()) + (negative ? 1 : 0);
+	quint64 magnitude = 0;
+	if (!parseDigits(begin, end, max, magnitude))
+		return false;
+	value = negative && magnitude ? -qint64(magnitude - 1) - 1 : qint64(magnitude);
+	return true;
+}
+
+bool QSUPERMACROS_NAMESPACE::qJsonToUInt64(const QJsonValue& json, quint64& value)
+{
+	if (json.isDouble())
+	{
+		const double number = json.toDouble();
+		if (!isExactInteger(number) || number < 0)
+			return false;
+		value = quint64(number);
+		return true;
 	}
+	if (!json.isString())
+		return false;
+
+	const QString string = json.toString();
+	const QChar* begin = string.constData();
+	const QChar* end = begin + string.size();
+	trimmed(begin, end);
+	if (begin != end && *begin == QLatin1Char('+'))
+		++begin;
+	return parseDigits(begin, end, std::numeric_limits<quint64>::max(), value);
+}
+
+QJsonValue QSUPERMACROS_NAMESPACE::qJsonFromInt64(const qint64 value)
+{
+	return value < 0 ? formatInteger(0 - quint64(value), true) : formatInteger(quint64(value), false);
+}
+
+QJsonValue QSUPERMACROS_NAMESPACE::qJsonFromUInt64(const quint64 value)
+{
+	return formatInteger(value, false);
+}
 
+bool QJsonExportable::dataSave(const QUrl& filepath, const bool fromJson) const
+{
+	return dataSave(filepath, fileFormat(fromJson));
+}
+
+bool QJsonExportable::dataSave(const QUrl& filepath, const QJsonFileFormat format) const
+{
 	QJsonObject jsonObject;
 	jsonWrite(jsonObject);
-	QJsonDocument saveDoc(jsonObject);
-	saveFile.write(fromJson ? saveDoc.toJson() : saveDoc.toBinaryData());
+	return writePayload(_savedPayload.data(), filepath.toLocalFile(), serializeDocument(jsonObject, format), _saveMode, _saveSync);
+}
 
-	return true;
+QFuture<bool> QJsonExportable::dataSaveAsync(const QUrl& filepath, const QJsonFileFormat format) const
+{
+	QJsonObject snapshot;
+	runInOwnerThread(dynamic_cast<const QObject*>(this), [this, &snapshot]()
+	{
+		jsonWrite(snapshot);
+	});
+
+	static QMutex stateMutex;
+	QSharedPointer<AsyncSave> state;
+	{
+		QMutexLocker stateLock(&stateMutex);
+		if (!_asyncSave)
+			_asyncSave = QSharedPointer<AsyncSave>::create();
+		state = _asyncSave;
+	}
+
+	const QString path = filepath.toLocalFile();
+	QMutexLocker lock(&state->mutex);
+	const auto queue = state->queues.find(path);
+
+	// Replace the last pending save of the same file and format, its caller get the newest snapshot
+	if (queue != state->queues.end() && !queue->isEmpty() && queue->last()->format == format)
+	{
+		PendingSave* pending = queue->last().data();
+		pending->snapshot = snapshot;
+		pending->mode = _saveMode;
+		pending->sync = _saveSync;
+		return pending->result.future();
+	}
+
+	const auto pending = QSharedPointer<PendingSave>::create();
+	pending->snapshot = snapshot;
+	pending->format = format;
+	pending->mode = _saveMode;
+	pending->sync = _saveSync;
+	pending->result.reportStarted();
+	const QFuture<bool> future = pending->result.future();
+
+	// The worker of the file write it after the saves before it
+	if (queue != state->queues.end())
+	{
+		queue->append(pending);
+		return future;
+	}
+
+	state->queues.insert(path, QList<QSharedPointer<PendingSave>>() << pending);
+	const QSharedPointer<SavedPayload> savedPayload = _savedPayload;
+	QtConcurrent::run([state, path, savedPayload]()
+	{
+		QMutexLocker workerLock(&state->mutex);
+		// Looked up at each turn, the hash can rehash while unlocked
+		while (!state->queues[path].isEmpty())
+		{
+			const QSharedPointer<PendingSave> save = state->queues[path].takeFirst();
+			workerLock.unlock();
+			const bool saved = writePayload(savedPayload.data(), path, serializeDocument(save->snapshot, save->format), save->mode, save->sync);
+			save->result.reportResult(saved);
+			save->result.reportFinished();
+			workerLock.relock();
+		}
+		state->queues.remove(path);
+	});
+	return future;
+}
+
+/**
+ * Write data like writeFile(), unless saved holds the same payload for filepath and the file still have its size and modification time.
+ * Without saved, always write.
+ * \return false if the write failed
+ */
+bool QJsonExportable::writePayload(SavedPayload* saved, const QString& filepath, const QByteArray& data, const SaveMode mode, const SaveSync sync)
+{
+	if (!saved)
+		return writeFile(filepath, data, mode, sync);
+
+	const quint64 hash = payloadHash(data);
+	QMutexLocker lock(&saved->mutex);
+	if (saved->valid && saved->hash == hash && saved->size == data.size() && saved->filepath == filepath)
+	{
+		const QFileInfo info(filepath);
+		if (info.exists() && info.size() == data.size() && info.lastModified() == saved->modified)
+		{
+			saved->written = false;
+			return true;
+		}
+	}
+
+	// Don't hold the lock during the write, a concurrent save only cost an extra write
+	lock.unlock();
+	const bool written = writeFile(filepath, data, mode, sync);
+	lock.relock();
+
+	saved->written = written;
+	saved->valid = written;
+	saved->filepath = filepath;
+	saved->hash = hash;
+	saved->size = data.size();
+	saved->modified = written ? QFileInfo(filepath).lastModified() : QDateTime();
+	return written;
+}
+
+/** Record a save whose payload isn't hashed. The file changed, so the next save of any payload write */
+void QJsonExportable::streamedWritten(SavedPayload* saved, const bool written)
+{
+	if (!saved)
+		return;
+	QMutexLocker lock(&saved->mutex);
+	saved->written = written;
+	saved->valid = false;
+}
+
+void QJsonExportable::setSkipUnchangedSaves(const bool skip)
+{
+	if (skip && !_savedPayload)
+		_savedPayload = QSharedPointer<SavedPayload>::create();
+	else if (!skip)
+		_savedPayload.reset();
+}
+
+bool QJsonExportable::lastSaveWritten() const
+{
+	if (!_savedPayload)
+		return true;
+	QMutexLocker lock(&_savedPayload->mutex);
+	return _savedPayload->written;
 }
 
 bool QJsonExportable::jsonSave(const QUrl& filepath) const
@@ -42,7 +602,138 @@ bool QJsonExportable::binarySave(const QUrl& filepath) const
 	return dataSave(filepath, false);
 }
 
+bool QJsonExportable::cborSave(const QUrl& filepath) const
+{
+	return dataSave(filepath, QJsonFileFormat::Cbor);
+}
+
+bool QJsonExportable::jsonStreamSave(const QUrl& filepath) const
+{
+	const bool written = writeFile(filepath.toLocalFile(), [this](QIODevice& file)
+	{
+		QJsonStreamWriter writer(&file);
+		jsonStreamWrite(writer);
+		return writer.flush();
+	}, _saveMode, _saveSync);
+	streamedWritten(_savedPayload.data(), written);
+	return written;
+}
+
+bool QJsonExportable::compressedSave(const QUrl& filepath, const QJsonFileFormat format, const int level) const
+{
+	const bool written = writeFile(filepath.toLocalFile(), [this, format, level](QIODevice& file)
+	{
+		QJsonCompressedDevice compressed(&file, quint8(format), level);
+		if (!compressed.open(QIODevice::WriteOnly))
+			return false;
+
+		if (format == QJsonFileFormat::Json)
+		{
+			QJsonStreamWriter writer(&compressed, QJsonDocument::Compact);
+			jsonStreamWrite(writer);
+			if (!writer.flush())
+				return false;
+		}
+		else
+		{
+			QJsonObject jsonObject;
+			jsonWrite(jsonObject);
+			const QByteArray data = serializeDocument(jsonObject, format);
+			if (compressed.write(data) != data.size())
+				return false;
+		}
+
+		compressed.close();
+		return !compressed.hasError();
+	}, _saveMode, _saveSync);
+	streamedWritten(_savedPayload.data(), written);
+	return written;
+}
+
+bool QJsonExportable::snapshotSave(const QUrl& filepath) const
+{
+	QJsonObject jsonObject;
+	jsonWrite(jsonObject);
+	return writePayload(_savedPayload.data(), filepath.toLocalFile(), QJsonSnapshot::fromJson(jsonObject), _saveMode, _saveSync);
+}
+
+void QJsonExportable::jsonWritePatch(QJsonObject& patch) const
+{
+	const QQmlDirtyTracker* tracker = dynamic_cast<const QQmlDirtyTracker*>(this);
+	if (tracker && !tracker->hasDirtyFields())
+		return;
+
+	QJsonObject json;
+	if (!tracker)
+	{
+		jsonWrite(json);
+		patch = json;
+		return;
+	}
+	if (!jsonWriteDirty(*tracker, json))
+		jsonWrite(json);
+
+	for (const QByteArray& field : tracker->dirtyFields())
+	{
+		const QString key = QString::fromLatin1(field);
+		const auto it = json.constFind(key);
+		patch.insert(key, it != json.constEnd() ? it.value() : QJsonValue(QJsonValue::Null));
+	}
+}
+
+void QJsonExportable::jsonStreamWrite(QJsonStreamWriter& writer) const
+{
+	QJsonObject json;
+	jsonWrite(json);
+	writer.writeValue(json);
+}
+
+QFuture<bool> QJsonExportable::jsonSaveAsync(const QUrl& filepath) const
+{
+	return dataSaveAsync(filepath, QJsonFileFormat::Json);
+}
+
+QFuture<bool> QJsonExportable::binarySaveAsync(const QUrl& filepath) const
+{
+	return dataSaveAsync(filepath, QJsonFileFormat::Binary);
+}
+
+QFuture<bool> QJsonExportable::cborSaveAsync(const QUrl& filepath) const
+{
+	return dataSaveAsync(filepath, QJsonFileFormat::Cbor);
+}
+
 bool QJsonImportable::dataLoad(const QUrl& filepath, const bool fromJson)
+{
+	return dataLoad(filepath, fileFormat(fromJson));
+}
+
+bool QJsonImportable::dataLoad(const QUrl& filepath, const QJsonFileFormat format)
+{
+	QJsonObject jsonObject;
+	if (!readDocument(filepath, format, jsonObject))
+		return false;
+
+	jsonRead(jsonObject);
+	return true;
+}
+
+bool QJsonImportable::jsonLoad(const QUrl& filepath)
+{
+	return dataLoad(filepath, true);
+}
+
+bool QJsonImportable::binaryLoad(const QUrl& filepath)
+{
+	return dataLoad(filepath, false);
+}
+
+bool QJsonImportable::cborLoad(const QUrl& filepath)
+{
+	return dataLoad(filepath, QJsonFileFormat::Cbor);
+}
+
+bool QJsonImportable::compressedLoad(const QUrl& filepath)
 {
 	QFile loadFile(filepath.toLocalFile());
 
@@ -52,19 +743,140 @@ bool QJsonImportable::dataLoad(const QUrl& filepath, const bool fromJson)
 		return false;
 	}
 
-	const QByteArray saveData = loadFile.readAll();
-	QJsonDocument loadDoc(fromJson ? QJsonDocument::fromJson(saveData) : QJsonDocument::fromBinaryData(saveData));
-	jsonRead(loadDoc.object());
+	QJsonCompressedDevice compressed(&loadFile);
+	if (!compressed.open(QIODevice::ReadOnly) || compressed.format() > quint8(QJsonFileFormat::Cbor))
+	{
+		qWarning("Couldn't load Json file : invalid compressed header");
+		return false;
+	}
+
+	const QJsonFileFormat format = QJsonFileFormat(compressed.format());
+	if (format == QJsonFileFormat::Json)
+	{
+		QJsonStreamReader reader(&compressed);
+		return streamLoad(*this, reader) && !compressed.hasError();
+	}
+
+	QJsonObject jsonObject;
+	const QByteArray data = compressed.readAll();
+	if (compressed.hasError() || !parseDocument(data, format, jsonObject))
+		return false;
 
+	jsonRead(jsonObject);
 	return true;
 }
 
-bool QJsonImportable::jsonLoad(const QUrl& filepath)
+QFuture<bool> QJsonImportable::jsonLoadAll(const QVector<QPair<QJsonImportable*, QUrl>>& files)
 {
-	return dataLoad(filepath, true);
+	return QtConcurrent::mapped(files, JsonFileLoader());
 }
 
-bool QJsonImportable::binaryLoad(const QUrl& filepath)
+bool QJsonImportable::jsonStreamLoad(const QUrl& filepath)
 {
-	return dataLoad(filepath, false);
+	QFile loadFile(filepath.toLocalFile());
+
+	if (!loadFile.open(QIODevice::ReadOnly))
+	{
+		qWarning("Couldn't open Json file to load.");
+		return false;
+	}
+
+	QByteArray mappedData;
+	if (mapFileData(loadFile, mappedData))
+	{
+		QJsonStreamReader reader(mappedData);
+		return streamLoad(*this, reader);
+	}
+
+	QJsonStreamReader reader(&loadFile);
+	return streamLoad(*this, reader);
+}
+
+bool QJsonImportable::jsonPointerLoad(const QUrl& filepath, const QString& pointer)
+{
+	return jsonPointerLoad(filepath, { qMakePair(pointer, this) });
+}
+
+bool QJsonImportable::jsonPointerLoad(const QUrl& filepath, const QVector<QPair<QString, QJsonImportable*>>& targets)
+{
+	QFile loadFile(filepath.toLocalFile());
+
+	if (!loadFile.open(QIODevice::ReadOnly))
+	{
+		qWarning("Couldn't open Json file to load.");
+		return false;
+	}
+
+	QVector<QJsonPointer> pointers;
+	pointers.reserve(targets.size());
+	for (const auto& target : targets)
+		pointers.append(QJsonPointer(target.first));
+
+	QVector<QJsonValue> values;
+	QByteArray mappedData;
+	if (mapFileData(loadFile, mappedData))
+	{
+		QJsonStreamReader reader(mappedData);
+		values = QJsonPointer::select(reader, pointers);
+	}
+	else
+	{
+		QJsonStreamReader reader(&loadFile);
+		values = QJsonPointer::select(reader, pointers);
+	}
+
+	if (values.isEmpty() && !targets.isEmpty())
+	{
+		qWarning("Couldn't load Json file : syntax error");
+		return false;
+	}
+
+	bool loaded = true;
+	for (int i = 0; i < targets.size(); ++i)
+	{
+		if (!values.at(i).isObject() || !targets.at(i).second)
+		{
+			qWarning("Json pointer %s isn't an object", qPrintable(targets.at(i).first));
+			loaded = false;
+			continue;
+		}
+		targets.at(i).second->jsonRead(values.at(i).toObject());
+	}
+	return loaded;
+}
+
+bool QJsonImportable::snapshotLoad(const QUrl& filepath)
+{
+	QJsonSnapshot snapshot;
+	if (!snapshot.open(filepath.toLocalFile()))
+	{
+		qWarning("Couldn't load Json snapshot : can't map the file or invalid header");
+		return false;
+	}
+
+	snapshotRead(snapshot.root());
+	return true;
+}
+
+void QJsonImportable::snapshotRead(const QJsonSnapshotObject& json)
+{
+	jsonRead(json.toJsonObject());
+}
+
+bool QJsonImportable::jsonStreamRead(QJsonStreamReader& reader)
+{
+	// jsonRead() may read members together, so it get the whole object at once
+	const QJsonValue value = reader.readValue();
+	if (!value.isObject())
+		return false;
+	jsonRead(value.toObject());
+	return true;
+}
+
+bool QJsonImportExport::binaryToCbor(const QUrl& binaryFile, const QUrl& cborFile)
+{
+	QJsonObject jsonObject;
+	if (!readDocument(binaryFile, QJsonFileFormat::Binary, jsonObject))
+		return false;
+	return writeFile(cborFile.toLocalFile(), QJsonCbor::toCbor(jsonObject), SaveMode::Atomic, SaveSync::SyncFile);
 }
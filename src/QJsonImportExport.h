@@ -18,25 +18,40 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QFile>
+#include <QFuture>
+#include <QPair>
+#include <QSharedPointer>
 #include <QUrl>
+#include <QVector>
 
 // Dependencies Header
 
 // Application Header
 #include <QSuperMacros.h>
+#include <QQmlDirtyTracker.h>
+#include <QJsonCompressedDevice.h>
+#include <QJsonMetaSerializer.h>
+#include <QJsonPointer.h>
+#include <QJsonSnapshot.h>
+#include <QJsonStreamReader.h>
+#include <QJsonStreamWriter.h>
 
 // ─────────────────────────────────────────────────────────────
 //					DECLARATION
 // ─────────────────────────────────────────────────────────────
 
 // ───────── GLOBAL ───────────
+/** Lookup jsonName only once in json. Literal keys are used as QLatin1String, no QString is built */
+#define QJSONIMPORT_FIELD(jsonName, jsonType) \
+	QSUPERMACROS_NAMESPACE::qJsonImportField(json, QSUPERMACROS_NAMESPACE::qJsonImportKey(jsonName), QJsonValue::jsonType) \
+
 #define QJSONIMPORT_ISVALID(jsonName, jsonType) \
-	json.contains(jsonName) && json[jsonName].is##jsonType() \
+	bool(QJSONIMPORT_FIELD(jsonName, jsonType)) \
 
 #define QJSONIMPORT(jsonName, setter, type, jsonType) \
-	if (QJSONIMPORT_ISVALID(jsonName, jsonType)) \
+	if (const auto _jsonField = QJSONIMPORT_FIELD(jsonName, jsonType)) \
 	{ \
-		setter((type)(json[jsonName].to##jsonType())); \
+		setter((type)(_jsonField.value().to##jsonType())); \
 	} \
 
 #define QJSONIMPORT_WLOG(jsonName, setter, type, jsonType, logCat) \
@@ -48,16 +63,79 @@
 	} \
 }
 
+/**
+ * Implement jsonRead() and snapshotRead() with the same template function, so QJSONIMPORT_* macros read both without any conversion.
+ * \code
+ * template<typename Json> void readFields(const Json& json) { QJSONIMPORT_INT("x", setX); }
+ * QJSONIMPORT_SNAPSHOT(readFields)
+ * \endcode
+ */
+#define QJSONIMPORT_SNAPSHOT(readFields) \
+public: \
+	void jsonRead(const QJsonObject& json) override { readFields(json); } \
+	void snapshotRead(const QSUPERMACROS_NAMESPACE::QJsonSnapshotObject& json) override { readFields(json); } \
+private:
+
 #define QJSONEXPORT(jsonName, value) \
 	json[jsonName] = value; \
 
+/** Write the member straight to the QJsonStreamWriter writer, in jsonStreamWrite() */
+#define QJSONSTREAMEXPORT(jsonName, value) \
+	writer.writeMember(QSUPERMACROS_NAMESPACE::qJsonImportKey(jsonName), value); \
+
+/**
+ * Open the member loop of jsonStreamRead(QJsonStreamReader& reader). Each following QJSONSTREAMIMPORT_* read its
+ * member straight from reader, the other members are skipped without being decoded.
+ * QJSONSTREAMIMPORT_END close the loop and return from jsonStreamRead().
+ * \code
+ * bool jsonStreamRead(QJsonStreamReader& reader) override
+ * {
+ *     QJSONSTREAMIMPORT_BEGIN
+ *     QJSONSTREAMIMPORT_INT("x", setX)
+ *     QJSONSTREAMIMPORT_OBJECT("child", child)
+ *     QJSONSTREAMIMPORT_END
+ * }
+ * \endcode
+ */
+#define QJSONSTREAMIMPORT_BEGIN \
+	while (reader.readNext() == QSUPERMACROS_NAMESPACE::QJsonStreamReader::Name) \
+	{ \
+		if (false) {} \
+
+#define QJSONSTREAMIMPORT_END \
+		else if (!reader.skipValue()) \
+		{ \
+			return false; \
+		} \
+	} \
+	return reader.tokenType() == QSUPERMACROS_NAMESPACE::QJsonStreamReader::EndObject; \
+
+/** True if the current member of reader is jsonName */
+#define QJSONSTREAMIMPORT_ISNAME(jsonName) \
+	(reader.name() == QSUPERMACROS_NAMESPACE::qJsonImportKey(jsonName)) \
+
+/** Read the member with setter if it is a jsonType, between QJSONSTREAMIMPORT_BEGIN and QJSONSTREAMIMPORT_END */
+#define QJSONSTREAMIMPORT(jsonName, setter, type, jsonType) \
+	else if (QJSONSTREAMIMPORT_ISNAME(jsonName)) \
+	{ \
+		const QJsonValue _jsonStreamValue = QSUPERMACROS_NAMESPACE::qJsonStreamReadScalar(reader); \
+		if (_jsonStreamValue.isUndefined()) \
+		{ \
+			return false; \
+		} \
+		if (_jsonStreamValue.is##jsonType()) \
+		{ \
+			setter((type)(_jsonStreamValue.to##jsonType())); \
+		} \
+	} \
+
 // ───────── OBJECT ───────────
 #define QJSONIMPORT_ISOBJECTVALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Object) \
 
 #define QJSONIMPORT_OBJECT(jsonName, objectDest) \
-	if (QJSONIMPORT_ISOBJECTVALID(jsonName)) \
+	if (const auto _jsonObjectField = QJSONIMPORT_FIELD(jsonName, Object)) \
 	{ \
-		objectDest->jsonRead(json[jsonName].toObject()); \
+		QSUPERMACROS_NAMESPACE::qJsonRead(objectDest, _jsonObjectField.value().toObject()); \
 	} \
 
 #define QJSONIMPORT_OBJECT_WLOG(jsonName, objectDest, logCat) \
@@ -70,7 +148,7 @@
 }
 
 #define QJSONIMPORT_OBJECT_FROMARRAY(object) \
-	object->jsonRead(it.toObject());
+	QSUPERMACROS_NAMESPACE::qJsonRead(object, it.toObject());
 
 #define QJSONEXPORT_OBJECT(jsonName, objectSrc) \
 { \
@@ -79,15 +157,45 @@
 	json[jsonName] = jsonObj; \
 }
 
+#define QJSONSTREAMEXPORT_OBJECT(jsonName, objectSrc) \
+{ \
+	writer.writeName(QSUPERMACROS_NAMESPACE::qJsonImportKey(jsonName)); \
+	objectSrc->jsonStreamWrite(writer); \
+}
+
+/** Stream the member to objectDest->jsonStreamRead(). A member that isn't an object is skipped */
+#define QJSONSTREAMIMPORT_OBJECT(jsonName, objectDest) \
+	else if (QJSONSTREAMIMPORT_ISNAME(jsonName)) \
+	{ \
+		if (reader.readNext() == QSUPERMACROS_NAMESPACE::QJsonStreamReader::StartObject) \
+		{ \
+			if (!objectDest->jsonStreamRead(reader)) \
+			{ \
+				return false; \
+			} \
+		} \
+		else if (!reader.skipValue()) \
+		{ \
+			return false; \
+		} \
+	} \
+
+/** Stream the object of the array, in QJSONSTREAMIMPORT_ARRAY_OBJECT instructions */
+#define QJSONSTREAMIMPORT_OBJECT_FROMARRAY(object) \
+	if (!object->jsonStreamRead(reader)) \
+	{ \
+		return false; \
+	} \
+
 // ───────── ARRAY ───────────
 #define QJSONIMPORT_ISARRAYVALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Array) \
 
 #define QJSONIMPORT_ARRAY_OBJECT_WLOG(jsonName, logCat, instructions) \
 { \
-	if (QJSONIMPORT_ISARRAYVALID(jsonName)) \
+	if (const auto _jsonArrayField = QJSONIMPORT_FIELD(jsonName, Array)) \
 	{ \
-		QJsonArray arrayObject = json[jsonName].toArray(); \
-		for (auto it : arrayObject) \
+		const auto arrayObject = _jsonArrayField.value().toArray(); \
+		for (const auto& it : arrayObject) \
 		{ \
 			if (it.isObject()) \
 			{ \
@@ -108,7 +216,7 @@
 #define QJSONEXPORT_ARRAY_OBJECT(jsonName, list) \
 { \
 	QJsonArray arrayObject; \
-	for (auto it : list) \
+	for (const auto& it : list) \
 	{ \
 		QJsonObject jsonObject; \
 		it->jsonWrite(jsonObject); \
@@ -117,34 +225,94 @@
 	QJSONEXPORT(jsonName, arrayObject); \
 }
 
+#define QJSONSTREAMEXPORT_ARRAY_OBJECT(jsonName, list) \
+{ \
+	writer.writeName(QSUPERMACROS_NAMESPACE::qJsonImportKey(jsonName)); \
+	writer.writeStartArray(); \
+	for (const auto& it : list) \
+	{ \
+		it->jsonStreamWrite(writer); \
+	} \
+	writer.writeEndArray(); \
+}
+
+/**
+ * Run instructions for each object of the array, with reader on its StartObject token.
+ * instructions must consume the object up to its EndObject, ie with QJSONSTREAMIMPORT_OBJECT_FROMARRAY.
+ * Other elements are skipped.
+ */
+#define QJSONSTREAMIMPORT_ARRAY_OBJECT(jsonName, instructions) \
+	else if (QJSONSTREAMIMPORT_ISNAME(jsonName)) \
+	{ \
+		if (reader.readNext() == QSUPERMACROS_NAMESPACE::QJsonStreamReader::StartArray) \
+		{ \
+			while (reader.readNext() != QSUPERMACROS_NAMESPACE::QJsonStreamReader::EndArray) \
+			{ \
+				if (reader.tokenType() == QSUPERMACROS_NAMESPACE::QJsonStreamReader::StartObject) \
+				{ \
+					instructions; \
+				} \
+				else if (!reader.skipValue()) \
+				{ \
+					return false; \
+				} \
+			} \
+		} \
+		else if (!reader.skipValue()) \
+		{ \
+			return false; \
+		} \
+	} \
+
 // ───────── UINT64 ───────────
-#define QJSONIMPORT_ISUINT64VALID(jsonName) QJSONIMPORT_ISVALID(jsonName, String) \
+/** True if the member is a string holding a uint64, or a number holding an exact integer */
+#define QJSONIMPORT_ISUINT64VALID(jsonName) \
+	QSUPERMACROS_NAMESPACE::qJsonIsUInt64(QJSONIMPORT_FIELD(jsonName, String).value()) \
 
 #define QJSONIMPORT_UINT64(jsonName, setter) \
-	if (QJSONIMPORT_ISUINT64VALID(jsonName)) \
+{ \
+	quint64 _jsonUInt64 = 0; \
+	if (QSUPERMACROS_NAMESPACE::qJsonToUInt64(QJSONIMPORT_FIELD(jsonName, String).value(), _jsonUInt64)) \
 	{ \
-		setter(json[jsonName].toString.toULongLong()); \
+		setter(_jsonUInt64); \
 	} \
+}
 
 #define QJSONIMPORT_UINT64_WLOG(jsonName, setter, logCat) \
 { \
-	if (QJSONIMPORT_ISUINT64VALID(jsonName)) \
+	quint64 _jsonUInt64 = 0; \
+	if (QSUPERMACROS_NAMESPACE::qJsonToUInt64(QJSONIMPORT_FIELD(jsonName, String).value(), _jsonUInt64)) \
 	{ \
-		bool stringValid = false; \
-		quint64 value = json[jsonName].toString().toULongLong(&stringValid); \
-		if (!stringValid) \
-		{ \
-			qCDebug(logCat, "Cannot convert String to uint64"); \
-		} \
-		setter(value); \
+		setter(_jsonUInt64); \
 	} \
 	else \
 	{ \
-		qCDebug(logCat, "%s isn't a valid Json String", qPrintable(jsonName)); \
+		qCDebug(logCat, "%s isn't a valid Json uint64", qPrintable(jsonName)); \
 	} \
 }
 
-#define QJSONEXPORT_UINT64(jsonName, value) QJSONEXPORT(jsonName, QString::number(value)) \
+#define QJSONEXPORT_UINT64(jsonName, value) QJSONEXPORT(jsonName, QSUPERMACROS_NAMESPACE::qJsonFromUInt64(value)) \
+
+#define QJSONSTREAMEXPORT_UINT64(jsonName, value) \
+{ \
+	writer.writeName(QSUPERMACROS_NAMESPACE::qJsonImportKey(jsonName)); \
+	writer.writeValueAsString(quint64(value)); \
+}
+
+#define QJSONSTREAMIMPORT_UINT64(jsonName, setter) \
+	else if (QJSONSTREAMIMPORT_ISNAME(jsonName)) \
+	{ \
+		const QJsonValue _jsonStreamValue = QSUPERMACROS_NAMESPACE::qJsonStreamReadScalar(reader); \
+		quint64 _jsonUInt64 = 0; \
+		if (_jsonStreamValue.isUndefined()) \
+		{ \
+			return false; \
+		} \
+		if (QSUPERMACROS_NAMESPACE::qJsonToUInt64(_jsonStreamValue, _jsonUInt64)) \
+		{ \
+			setter(_jsonUInt64); \
+		} \
+	} \
 
 // ───────── UINT32 ───────────
 #define QJSONIMPORT_ISUINT32VALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
@@ -155,6 +323,10 @@
 
 #define QJSONEXPORT_UINT32(jsonName, value) QJSONEXPORT(jsonName, (double) value) \
 
+#define QJSONSTREAMEXPORT_UINT32(jsonName, value) QJSONSTREAMEXPORT(jsonName, (double) value) \
+
+#define QJSONSTREAMIMPORT_UINT32(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, quint32, Double) \
+
 // ───────── UINT16 ───────────
 #define QJSONIMPORT_ISUINT16VALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
 
@@ -164,6 +336,10 @@
 
 #define QJSONEXPORT_UINT16(jsonName, value) QJSONEXPORT(jsonName, (quint16) value) \
 
+#define QJSONSTREAMEXPORT_UINT16(jsonName, value) QJSONSTREAMEXPORT(jsonName, (quint16) value) \
+
+#define QJSONSTREAMIMPORT_UINT16(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, quint16, Double) \
+
 // ───────── UINT8 ───────────
 #define QJSONIMPORT_ISUINT8VALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
 
@@ -173,6 +349,10 @@
 
 #define QJSONEXPORT_UINT8(jsonName, value) QJSONEXPORT(jsonName, (quint8) value) \
 
+#define QJSONSTREAMEXPORT_UINT8(jsonName, value) QJSONSTREAMEXPORT(jsonName, (quint8) value) \
+
+#define QJSONSTREAMIMPORT_UINT8(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, quint8, Double) \
+
 // ───────── UINT ───────────
 #define QJSONIMPORT_ISUINTVALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
 
@@ -182,34 +362,59 @@
 
 #define QJSONEXPORT_UINT(jsonName, value) QJSONEXPORT(jsonName, (quint) value) \
 
+#define QJSONSTREAMEXPORT_UINT(jsonName, value) QJSONSTREAMEXPORT(jsonName, (uint) value) \
+
+#define QJSONSTREAMIMPORT_UINT(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, uint, Double) \
+
 // ───────── INT64 ───────────
-#define QJSONIMPORT_ISINT64VALID(jsonName) QJSONIMPORT_ISVALID(jsonName, String) \
+/** True if the member is a string holding an int64, or a number holding an exact integer */
+#define QJSONIMPORT_ISINT64VALID(jsonName) \
+	QSUPERMACROS_NAMESPACE::qJsonIsInt64(QJSONIMPORT_FIELD(jsonName, String).value()) \
 
 #define QJSONIMPORT_INT64(jsonName, setter) \
-	if (QJSONIMPORT_ISINT64VALID(jsonName)) \
+{ \
+	qint64 _jsonInt64 = 0; \
+	if (QSUPERMACROS_NAMESPACE::qJsonToInt64(QJSONIMPORT_FIELD(jsonName, String).value(), _jsonInt64)) \
 	{ \
-		setter(json[jsonName].toString.toLongLong()); \
+		setter(_jsonInt64); \
 	} \
+}
 
 #define QJSONIMPORT_INT64_WLOG(jsonName, setter, logCat) \
 { \
-	if (QJSONIMPORT_ISINT64VALID(jsonName)) \
+	qint64 _jsonInt64 = 0; \
+	if (QSUPERMACROS_NAMESPACE::qJsonToInt64(QJSONIMPORT_FIELD(jsonName, String).value(), _jsonInt64)) \
 	{ \
-		bool stringValid = false; \
-		qint64 value = json[jsonName].toString().toLongLong(&stringValid); \
-		if (!stringValid) \
-		{ \
-			qCDebug(logCat, "Cannot convert String to int64"); \
-		} \
-		setter(value); \
+		setter(_jsonInt64); \
 	} \
 	else \
 	{ \
-		qCDebug(logCat, "%s isn't a valid Json String", qPrintable(jsonName)); \
+		qCDebug(logCat, "%s isn't a valid Json int64", qPrintable(jsonName)); \
 	} \
 }
 
-#define QJSONEXPORT_INT64(jsonName, value) QJSONEXPORT(jsonName, QString::number(value)) \
+#define QJSONEXPORT_INT64(jsonName, value) QJSONEXPORT(jsonName, QSUPERMACROS_NAMESPACE::qJsonFromInt64(value)) \
+
+#define QJSONSTREAMEXPORT_INT64(jsonName, value) \
+{ \
+	writer.writeName(QSUPERMACROS_NAMESPACE::qJsonImportKey(jsonName)); \
+	writer.writeValueAsString(qint64(value)); \
+}
+
+#define QJSONSTREAMIMPORT_INT64(jsonName, setter) \
+	else if (QJSONSTREAMIMPORT_ISNAME(jsonName)) \
+	{ \
+		const QJsonValue _jsonStreamValue = QSUPERMACROS_NAMESPACE::qJsonStreamReadScalar(reader); \
+		qint64 _jsonInt64 = 0; \
+		if (_jsonStreamValue.isUndefined()) \
+		{ \
+			return false; \
+		} \
+		if (QSUPERMACROS_NAMESPACE::qJsonToInt64(_jsonStreamValue, _jsonInt64)) \
+		{ \
+			setter(_jsonInt64); \
+		} \
+	} \
 
 // ───────── INT32 ───────────
 #define QJSONIMPORT_ISINT32VALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
@@ -220,6 +425,10 @@
 
 #define QJSONEXPORT_INT32(jsonName, value) QJSONEXPORT(jsonName, (qint32) value) \
 
+#define QJSONSTREAMEXPORT_INT32(jsonName, value) QJSONSTREAMEXPORT(jsonName, (qint32) value) \
+
+#define QJSONSTREAMIMPORT_INT32(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, qint32, Double) \
+
 // ───────── INT16 ───────────
 #define QJSONIMPORT_ISINT16VALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
 
@@ -229,6 +438,10 @@
 
 #define QJSONEXPORT_INT16(jsonName, value) QJSONEXPORT(jsonName, (qint16) value) \
 
+#define QJSONSTREAMEXPORT_INT16(jsonName, value) QJSONSTREAMEXPORT(jsonName, (qint16) value) \
+
+#define QJSONSTREAMIMPORT_INT16(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, qint16, Double) \
+
 // ───────── INT8 ───────────
 #define QJSONIMPORT_ISINT8VALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
 
@@ -238,6 +451,10 @@
 
 #define QJSONEXPORT_INT8(jsonName, value) QJSONEXPORT(jsonName, (qint8) value) \
 
+#define QJSONSTREAMEXPORT_INT8(jsonName, value) QJSONSTREAMEXPORT(jsonName, (qint8) value) \
+
+#define QJSONSTREAMIMPORT_INT8(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, qint8, Double) \
+
 // ───────── INT ───────────
 #define QJSONIMPORT_ISINTVALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
 
@@ -247,6 +464,10 @@
 
 #define QJSONEXPORT_INT(jsonName, value) QJSONEXPORT(jsonName, (int) value) \
 
+#define QJSONSTREAMEXPORT_INT(jsonName, value) QJSONSTREAMEXPORT(jsonName, (int) value) \
+
+#define QJSONSTREAMIMPORT_INT(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, int, Double) \
+
 // ───────── BOOL ───────────
 #define QJSONIMPORT_ISBOOLVALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Bool) \
 
@@ -256,6 +477,10 @@
 
 #define QJSONEXPORT_BOOL(jsonName, value) QJSONEXPORT(jsonName, (bool) value) \
 
+#define QJSONSTREAMEXPORT_BOOL(jsonName, value) QJSONSTREAMEXPORT(jsonName, (bool) value) \
+
+#define QJSONSTREAMIMPORT_BOOL(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, bool, Bool) \
+
 // ───────── STRING ───────────
 #define QJSONIMPORT_ISSTRINGVALID(jsonName) QJSONIMPORT_ISVALID(jsonName, String) \
 
@@ -265,6 +490,10 @@
 
 #define QJSONEXPORT_STRING(jsonName, value) QJSONEXPORT(jsonName, (QString) value) \
 
+#define QJSONSTREAMEXPORT_STRING(jsonName, value) QJSONSTREAMEXPORT(jsonName, (QString) value) \
+
+#define QJSONSTREAMIMPORT_STRING(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, QString, String) \
+
 // ───────── FLOAT ───────────
 #define QJSONIMPORT_ISFLOATVALID(jsonName) QJSONIMPORT_ISVALID(jsonName, Double) \
 
@@ -274,21 +503,143 @@
 
 #define QJSONEXPORT_FLOAT(jsonName, value) QJSONEXPORT(jsonName, (float) value) \
 
+#define QJSONSTREAMEXPORT_FLOAT(jsonName, value) QJSONSTREAMEXPORT(jsonName, (float) value) \
+
+#define QJSONSTREAMIMPORT_FLOAT(jsonName, setter) QJSONSTREAMIMPORT(jsonName, setter, float, Double) \
+
 
 QSUPERMACROS_NAMESPACE_START
 
+// ─────────────────────────────────────────────────────────────
+//					HELPERS
+// ─────────────────────────────────────────────────────────────
+
+/** Key of a json member written as a literal, no QString is built */
+inline QLatin1String qJsonImportKey(const char* key) { return QLatin1String(key); }
+/** Key of a json member already stored in a QString */
+inline const QString& qJsonImportKey(const QString& key) { return key; }
+
+/** Read the value of the current Name token, used by QJSONSTREAMIMPORT_* macros. Containers are skipped and read as null. \return Undefined on error */
+inline QJsonValue qJsonStreamReadScalar(QJsonStreamReader& reader)
+{
+	switch (reader.readNext())
+	{
+	case QJsonStreamReader::StartObject:
+	case QJsonStreamReader::StartArray:
+		return reader.skipValue() ? QJsonValue(QJsonValue::Null) : QJsonValue(QJsonValue::Undefined);
+	default:
+		return reader.readValue();
+	}
+}
+
+/** Parse a 64 bits integer in place from a json string, or from a json number holding an exact integer (up to 2^53). \return false if json isn't a valid int64 */
+QSUPERMACROS_API_ bool qJsonToInt64(const QJsonValue& json, qint64& value);
+/** Parse a 64 bits unsigned integer in place from a json string, or from a json number holding an exact integer (up to 2^53). \return false if json isn't a valid uint64 */
+QSUPERMACROS_API_ bool qJsonToUInt64(const QJsonValue& json, quint64& value);
+/** True if json is a valid int64, see qJsonToInt64() */
+inline bool qJsonIsInt64(const QJsonValue& json) { qint64 value; return qJsonToInt64(json, value); }
+/** True if json is a valid uint64, see qJsonToUInt64() */
+inline bool qJsonIsUInt64(const QJsonValue& json) { quint64 value; return qJsonToUInt64(json, value); }
+/** Same as qJsonToInt64() for a snapshot value */
+inline bool qJsonToInt64(const QJsonSnapshotValue& json, qint64& value) { return qJsonToInt64(json.toJsonValue(), value); }
+/** Same as qJsonToUInt64() for a snapshot value */
+inline bool qJsonToUInt64(const QJsonSnapshotValue& json, quint64& value) { return qJsonToUInt64(json.toJsonValue(), value); }
+inline bool qJsonIsInt64(const QJsonSnapshotValue& json) { qint64 value; return qJsonToInt64(json, value); }
+inline bool qJsonIsUInt64(const QJsonSnapshotValue& json) { quint64 value; return qJsonToUInt64(json, value); }
+/** Json string of value, formatted on the stack */
+QSUPERMACROS_API_ QJsonValue qJsonFromInt64(const qint64 value);
+/** Json string of value, formatted on the stack */
+QSUPERMACROS_API_ QJsonValue qJsonFromUInt64(const quint64 value);
+
+/** Json member found with a single lookup. Evaluate to true if the member exists with the expected type */
+class QJsonImportField
+{
+public:
+	template<typename Key>
+	QJsonImportField(const QJsonObject& json, const Key& key, const QJsonValue::Type type)
+	{
+		const QJsonObject::const_iterator it = json.constFind(key);
+		if (it != json.constEnd())
+		{
+			_value = it.value();
+			_valid = _value.type() == type;
+		}
+	}
+
+	/** True if the member exists with the expected type */
+	explicit operator bool() const { return _valid; }
+	/** Value of the member */
+	const QJsonValue& value() const { return _value; }
+
+private:
+	QJsonValue _value;
+	bool _valid = false;
+};
+
+/** Read a nested object, used by QJSONIMPORT_OBJECT macros */
+template<typename Dest>
+inline void qJsonRead(const Dest& dest, const QJsonObject& json) { dest->jsonRead(json); }
+/** Read a nested object from a snapshot, used by QJSONIMPORT_OBJECT macros */
+template<typename Dest>
+inline void qJsonRead(const Dest& dest, const QJsonSnapshotObject& json) { dest->snapshotRead(json); }
+
+/** Find key in json with a single lookup, used by QJSONIMPORT_* macros */
+template<typename Key>
+inline QJsonImportField qJsonImportField(const QJsonObject& json, const Key& key, const QJsonValue::Type type)
+{
+	return QJsonImportField(json, key, type);
+}
+
 // ─────────────────────────────────────────────────────────────
 //					CLASS
 // ─────────────────────────────────────────────────────────────
 
+/** On disk format of a save */
+enum class QJsonFileFormat
+{
+	/** Indented json text */
+	Json,
+	/** Qt binary json. Deprecated since Qt 5.15 and removed in Qt 6, where it's written as Cbor */
+	Binary,
+	/** CBOR (RFC 7049), compact and fast to parse */
+	Cbor
+};
+
 /** An object that can be export to a json document */
 class QSUPERMACROS_API_ QJsonExportable
 {
 public:
+	/** How a save write the file */
+	enum class SaveMode
+	{
+		/** Truncate the file and write it in place. A crash while writing leave a corrupted file */
+		InPlace,
+		/** Write a temporary file with QSaveFile, then rename it over the file on commit. The commit always fsync the file, whatever the SaveSync */
+		Atomic
+	};
+	/** Durability of a save, ie what is flushed to the disk before the save is reported as done */
+	enum class SaveSync
+	{
+		/** Let the OS flush the data when it wants. Fastest, for high frequency InPlace saves */
+		NoSync,
+		/** fsync the file content before commit. Same as NoSync for Atomic saves, QSaveFile already sync on commit */
+		SyncFile,
+		/** fsync the file content, then the directory entry after the rename. Safest, for shutdown saves */
+		SyncFileAndDirectory
+	};
+
+public:
+	QJsonExportable() = default;
+	/** Asynchronous save state and last saved payload aren't shared between copies */
+	QJsonExportable(const QJsonExportable& other) : _saveMode(other._saveMode), _saveSync(other._saveSync) { setSkipUnchangedSaves(other.skipUnchangedSaves()); }
+	/** Asynchronous save state and last saved payload aren't shared between copies */
+	QJsonExportable& operator=(const QJsonExportable& other) { _saveMode = other._saveMode; _saveSync = other._saveSync; setSkipUnchangedSaves(other.skipUnchangedSaves()); return *this; }
 	/** Public virtual Destructor */
 	virtual ~QJsonExportable() = default;
 protected:
 	bool dataSave(const QUrl& filepath, const bool fromJson = true) const;
+	bool dataSave(const QUrl& filepath, const QJsonFileFormat format) const;
+	QFuture<bool> dataSaveAsync(const QUrl& filepath, const QJsonFileFormat format) const;
 public:
 	/** Save the object in the filepath.
 	 * \return If the save succeed
@@ -296,8 +647,82 @@ public:
 	virtual bool jsonSave(const QUrl& filepath) const;
 	/** Save the object in the filepath. \return If the save succeed */
 	virtual bool binarySave(const QUrl& filepath) const;
+	/** Save the object in the filepath as CBOR. The object of jsonWrite() is encoded without any intermediate QCborValue. \return If the save succeed */
+	virtual bool cborSave(const QUrl& filepath) const;
+	/** Save the object in the filepath with jsonStreamWrite(), the tokens go straight to the file. \return If the save succeed */
+	virtual bool jsonStreamSave(const QUrl& filepath) const;
+	/**
+	 * Save the object in the filepath compressed block by block, with a header recording the codec and the format.
+	 * Json is streamed with jsonStreamWrite() in compact form. level is the zlib level, -1 for the default.
+	 * \return If the save succeed
+	 */
+	bool compressedSave(const QUrl& filepath, const QJsonFileFormat format = QJsonFileFormat::Json, const int level = -1) const;
+	/** Save the object in the filepath as a QJsonSnapshot, to be mapped by snapshotLoad(). \return If the save succeed */
+	bool snapshotSave(const QUrl& filepath) const;
+	/**
+	 * Snapshot the object with jsonWrite() in its thread (main thread if it isn't a QObject),
+	 * then serialize and write the file in the global thread pool.
+	 * Saves of the same file are written one after the other, in the order they were requested.
+	 * A save requested while the previous one of the same file and format still waits replace its
+	 * snapshot and get its future, so the newest snapshot win. Other saves get their own future.
+	 * \return Future that finish once the snapshot is written, true if the save succeed
+	 */
+	QFuture<bool> jsonSaveAsync(const QUrl& filepath) const;
+	/** Same as jsonSaveAsync() with binary format */
+	QFuture<bool> binarySaveAsync(const QUrl& filepath) const;
+	/** Same as jsonSaveAsync() with CBOR format */
+	QFuture<bool> cborSaveAsync(const QUrl& filepath) const;
+
+	/** Set how every following save write the file. Default to InPlace without sync */
+	void setSaveMode(const SaveMode mode, const SaveSync sync = SaveSync::NoSync) { _saveMode = mode; _saveSync = sync; }
+	/** How the saves write the file */
+	SaveMode saveMode() const { return _saveMode; }
+	/** What the saves flush to the disk */
+	SaveSync saveSync() const { return _saveSync; }
+	/**
+	 * Keep a 64 bits hash of the last payload written by jsonSave(), binarySave(), cborSave(), snapshotSave() and the async saves.
+	 * A save whose payload hash the same, to the same path, is skipped and reported as succeeded,
+	 * unless the file was removed, resized or modified meanwhile. The object is still serialized, only the disk write is saved.
+	 * Streamed and compressed saves always write, and the save that follow them too. Default to false.
+	 */
+	void setSkipUnchangedSaves(const bool skip);
+	/** If unchanged payloads are skipped */
+	bool skipUnchangedSaves() const { return bool(_savedPayload); }
+	/** True if the last save actually wrote the file, false if it was skipped or failed. Always true without setSkipUnchangedSaves() */
+	bool lastSaveWritten() const;
 	/** Dump the object in the json object */
 	virtual void jsonWrite(QJsonObject &json) const {};
+	/**
+	 * Write the whole object, from StartObject to EndObject.
+	 * Default implementation write the result of jsonWrite().
+	 * Override it with QJSONSTREAMEXPORT macros so no QJsonObject is ever built.
+	 */
+	virtual void jsonStreamWrite(QJsonStreamWriter& writer) const;
+	/**
+	 * Write a json merge patch (RFC 7386) of the fields that changed since the last QQmlDirtyTracker::clearDirty().
+	 * The object must also be a QQmlDirtyTracker, whose property names are the json keys.
+	 * Only the dirty fields are serialized when jsonWriteDirty() is implemented, otherwise they are picked from jsonWrite().
+	 * A dirty field that isn't written is written as null. Without tracker the whole object is written.
+	 * Call clearDirty() once the patch is sent, and apply it on the other side with jsonRead().
+	 */
+	void jsonWritePatch(QJsonObject& patch) const;
+	/**
+	 * Write only the fields that are dirty in tracker.
+	 * Implemented by QSM_JSON_SERIALIZABLE and QJSONMETA_IMPORTEXPORT from their field tables.
+	 * \return false if the class can't write a field alone, the default
+	 */
+	virtual bool jsonWriteDirty(const QQmlDirtyTracker& tracker, QJsonObject& json) const { Q_UNUSED(tracker); Q_UNUSED(json); return false; }
+
+private:
+	struct AsyncSave;
+	struct SavedPayload;
+	mutable QSharedPointer<AsyncSave> _asyncSave;
+	QSharedPointer<SavedPayload> _savedPayload;
+
+	static bool writePayload(SavedPayload* saved, const QString& filepath, const QByteArray& data, const SaveMode mode, const SaveSync sync);
+	static void streamedWritten(SavedPayload* saved, const bool written);
+	SaveMode _saveMode = SaveMode::InPlace;
+	SaveSync _saveSync = SaveSync::NoSync;
 };
 
 /** An object that can be import from a json document */
@@ -307,20 +732,79 @@ public:
 	/** Public virtual Destructor */
 	virtual ~QJsonImportable() = default;
 protected:
-	/** Real loader function */
+	/** Real loader function. Parsed documents are shared through QJsonDocumentCache */
 	bool dataLoad(const QUrl& filepath, const bool fromJson = true);
+	bool dataLoad(const QUrl& filepath, const QJsonFileFormat format);
 public:
 	/** Load from a Json file. \return If the load was a success */
 	virtual bool jsonLoad(const QUrl& filepath);
 	/** Load from a json binary file (very fast) \return if the load was a success */
 	virtual bool binaryLoad(const QUrl& filepath);
+	/** Load from a CBOR file. Legacy binary files are detected and read too, on Qt 5 only. \return if the load was a success */
+	virtual bool cborLoad(const QUrl& filepath);
+	/** Load a file written by compressedSave(). Json is inflated one block at a time and streamed to jsonStreamRead(). \return if the load was a success */
+	virtual bool compressedLoad(const QUrl& filepath);
+	/**
+	 * Load from a Json file with jsonStreamRead(), without building a QJsonDocument of the file.
+	 * Memory is only bounded by the nesting depth when jsonStreamRead() is overridden with the QJSONSTREAMIMPORT macros,
+	 * the default implementation builds the whole root object.
+	 * \return If the load was a success
+	 */
+	virtual bool jsonStreamLoad(const QUrl& filepath);
+	/**
+	 * Load only the object at pointer (RFC 6901, ie "/devices/42/calibration") of a Json file.
+	 * Everything else is skipped without being decoded, and the file is read only up to the end of that object.
+	 * \return If the object was found and read
+	 */
+	bool jsonPointerLoad(const QUrl& filepath, const QString& pointer);
+	/**
+	 * Load the objects at each pointer of a Json file in a single pass, and call jsonRead() of the matching importable.
+	 * \return true if every object was found and read
+	 */
+	static bool jsonPointerLoad(const QUrl& filepath, const QVector<QPair<QString, QJsonImportable*>>& targets);
+	/** Map a file written by snapshotSave() and call snapshotRead() on it, nothing is parsed. \return if the load was a success */
+	bool snapshotLoad(const QUrl& filepath);
+	/**
+	 * Load many Json files at once. Files are read and parsed in the global thread pool,
+	 * then jsonRead() is called in the thread of each importable (main thread if it isn't a QObject).
+	 * Don't block the owner threads on the future, use a QFutureWatcher instead.
+	 * \return A future with one result per file, in order, true if the load was a success
+	 */
+	static QFuture<bool> jsonLoadAll(const QVector<QPair<QJsonImportable*, QUrl>>& files);
 	/** Inflate from the json object */
 	virtual void jsonRead(const QJsonObject &json) {};
+	/**
+	 * Inflate the members that changed since the last read, ie on a QJsonHotReload reload.
+	 * diff holds the changed members, document the whole new object.
+	 * Default implementation read the whole document, as jsonRead() may rely on members that didn't change.
+	 * Override it to call jsonRead(diff) when each member can be read alone, so unchanged setters aren't called.
+	 */
+	virtual void jsonReadPatch(const QJsonObject& diff, const QJsonObject& document) { Q_UNUSED(diff); jsonRead(document); }
+	/**
+	 * Inflate from a reader positioned on the root StartObject token, and consume up to the matching EndObject.
+	 * Default implementation isn't streamed: it builds the whole object and call jsonRead() once.
+	 * Override it with QJSONSTREAMIMPORT macros to dispatch the values straight to the setters.
+	 * \return If the read was a success
+	 */
+	virtual bool jsonStreamRead(QJsonStreamReader& reader);
+	/**
+	 * Inflate from an object of a mapped snapshot. The snapshot is unmapped once the load is done.
+	 * Default implementation convert it to a QJsonObject for jsonRead().
+	 * Override it with QJSONIMPORT_SNAPSHOT so the fields are read in place.
+	 */
+	virtual void snapshotRead(const QJsonSnapshotObject& json);
 };
 
 /** An object that can be import and export to and from json format */
 class QSUPERMACROS_API_ QJsonImportExport : public QJsonExportable, public QJsonImportable
 {
+public:
+	/**
+	 * Convert a legacy binary json file to CBOR, so it stay readable once binary json is gone (Qt 6).
+	 * cborFile is written atomically, it can be the same file as binaryFile.
+	 * \return If the conversion succeed
+	 */
+	static bool binaryToCbor(const QUrl& binaryFile, const QUrl& cborFile);
 };
 
 QSUPERMACROS_NAMESPACE_END
@@ -0,0 +1,203 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonLines.h>
+#include <QJsonParallel.h>
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonParseError>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Batches smaller than that are parsed in the calling thread */
+static const int MinParallelBatch = 256;
+/** Lines parsed by one task of the global thread pool */
+static const int ParallelChunk = 64;
+
+static bool isBlank(const QByteArray& line)
+{
+	for (const char c : line)
+	{
+		if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+			return false;
+	}
+	return true;
+}
+
+/** Parse one line without any side effect, so it can run in any thread */
+static bool parseObject(const QByteArray& line, QJsonObject& json)
+{
+	QJsonParseError error;
+	const QJsonDocument document = QJsonDocument::fromJson(line, &error);
+	if (error.error != QJsonParseError::NoError || !document.isObject())
+		return false;
+	json = document.object();
+	return true;
+}
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+QJsonLinesWriter::QJsonLinesWriter(QIODevice* device) :
+	_device(device),
+	_writer(device, QJsonDocument::Compact)
+{
+}
+
+bool QJsonLinesWriter::append(const QJsonExportable& object)
+{
+	// Each object is a root value of the writer, flushed before the newline written to the device
+	object.jsonStreamWrite(_writer);
+	if (!_writer.flush())
+		return false;
+	return endLine();
+}
+
+bool QJsonLinesWriter::append(const QJsonObject& json)
+{
+	const QByteArray line = QJsonDocument(json).toJson(QJsonDocument::Compact);
+	if (_device->write(line) != line.size())
+		return false;
+	return endLine();
+}
+
+bool QJsonLinesWriter::endLine()
+{
+	if (!_device->putChar('\n'))
+		return false;
+	++_count;
+	return true;
+}
+
+bool QJsonLinesWriter::appendToFile(const QUrl& filepath, const QJsonExportable& object)
+{
+	QFile file(filepath.toLocalFile());
+	if (!file.open(QIODevice::ReadWrite | QIODevice::Append))
+	{
+		qWarning("Couldn't open Json lines file.");
+		return false;
+	}
+
+	// Terminate a line cut by a crash, so it doesn't swallow the new object
+	const qint64 size = file.size();
+	char last = '\n';
+	if (size > 0 && file.seek(size - 1) && file.getChar(&last) && last != '\n' && !file.putChar('\n'))
+		return false;
+
+	QJsonLinesWriter writer(&file);
+	if (!writer.append(object))
+	{
+		qWarning("Couldn't write Json lines file : %s", qPrintable(file.errorString()));
+		return false;
+	}
+	return true;
+}
+
+QJsonLinesReader::QJsonLinesReader(QIODevice* device) :
+	_device(device)
+{
+}
+
+bool QJsonLinesReader::readLine(QByteArray& line)
+{
+	while (!_device->atEnd())
+	{
+		line = _device->readLine();
+		++_lineNumber;
+		if (!isBlank(line))
+			return true;
+	}
+	return false;
+}
+
+bool QJsonLinesReader::parseLine(const QByteArray& line, QJsonObject& json)
+{
+	if (parseObject(line, json))
+		return true;
+	qWarning("Json lines : line %d isn't a json object, skipped", _lineNumber);
+	++_invalidLines;
+	return false;
+}
+
+bool QJsonLinesReader::readNext(QJsonObject& json)
+{
+	QByteArray line;
+	while (readLine(line))
+	{
+		if (parseLine(line, json))
+			return true;
+	}
+	return false;
+}
+
+int QJsonLinesReader::readBatch(QVector<QJsonObject>& objects, const int maxCount, const bool parallel)
+{
+	if (!parallel || maxCount < MinParallelBatch)
+	{
+		int read = 0;
+		QJsonObject json;
+		while (read < maxCount && readNext(json))
+		{
+			objects.append(json);
+			++read;
+		}
+		return read;
+	}
+
+	// A batch of invalid lines only is skipped, so 0 always mean the end
+	int read = 0;
+	QVector<QByteArray> lines;
+	QVector<int> lineNumbers;
+	lines.reserve(maxCount);
+	lineNumbers.reserve(maxCount);
+	while (!read)
+	{
+		lines.clear();
+		lineNumbers.clear();
+		QByteArray line;
+		while (lines.size() < maxCount && readLine(line))
+		{
+			lines.append(line);
+			lineNumbers.append(_lineNumber);
+		}
+
+		const int count = lines.size();
+		if (!count)
+			break;
+
+		QVector<QJsonObject> parsed(count);
+		QVector<char> valid(count, false);
+		QVector<QJsonParallelRange> ranges = qJsonParallelRanges(count, ParallelChunk);
+		QtConcurrent::blockingMap(ranges, [&lines, &parsed, &valid](const QJsonParallelRange& range)
+		{
+			for (int i = range.begin; i < range.end; ++i)
+				valid[i] = parseObject(lines.at(i), parsed[i]);
+		});
+
+		objects.reserve(objects.size() + count);
+		for (int i = 0; i < count; ++i)
+		{
+			if (!valid.at(i))
+			{
+				qWarning("Json lines : line %d isn't a json object, skipped", lineNumbers.at(i));
+				++_invalidLines;
+				continue;
+			}
+			objects.append(parsed.at(i));
+			++read;
+		}
+	}
+	return read;
+}
+
+bool QJsonLinesReader::atEnd() const
+{
+	return _device->atEnd();
+}
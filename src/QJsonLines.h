@@ -0,0 +1,126 @@
+/**
+ * \file QJsonLines.h
+ * \brief Newline delimited json (NDJSON) collections, one object per line
+ */
+#ifndef __QJSON_LINES_HPP__
+#define __QJSON_LINES_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+
+// Qt Header
+#include <QByteArray>
+#include <QIODevice>
+#include <QJsonObject>
+#include <QUrl>
+#include <QVector>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+#include <QJsonImportExport.h>
+#include <QJsonStreamWriter.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Append objects to a device, one compact json object per line.
+ * Each object is streamed with jsonStreamWrite(), so appending cost O(record) whatever the size of the file.
+ * The stream writer and its buffer are shared by every append, keep the QJsonLinesWriter alive to append many objects.
+ *
+ * \code
+ * QFile file(path);
+ * file.open(QIODevice::WriteOnly | QIODevice::Append);
+ * QJsonLinesWriter writer(&file);
+ * for (const auto& record : records)
+ *     writer.append(*record);
+ * \endcode
+ */
+class QSUPERMACROS_API_ QJsonLinesWriter
+{
+public:
+	/** Write to device, which must be open */
+	explicit QJsonLinesWriter(QIODevice* device);
+
+public:
+	/** Write object on a new line. \return false if the write to the device failed, then every next object streamed fail too */
+	bool append(const QJsonExportable& object);
+	/** Write json on a new line. \return false if the write to the device failed */
+	bool append(const QJsonObject& json);
+	/** Number of lines written */
+	int count() const { return _count; }
+
+	/** Open filepath in append mode and write object on a new line, without reading the file. \return If the append succeed */
+	static bool appendToFile(const QUrl& filepath, const QJsonExportable& object);
+
+private:
+	Q_DISABLE_COPY(QJsonLinesWriter)
+
+	bool endLine();
+
+private:
+	QIODevice* _device = nullptr;
+	QJsonStreamWriter _writer;
+	int _count = 0;
+};
+
+/**
+ * Read objects from a device written by QJsonLinesWriter, lazily one line or one batch at a time.
+ * Blank lines are ignored. Lines that aren't a json object, like a last line cut by a crash, are skipped and counted.
+ *
+ * \code
+ * QJsonLinesReader reader(&file);
+ * QJsonObject json;
+ * while (reader.readNext(json))
+ *     records.append(Record::fromJson(json));
+ * \endcode
+ */
+class QSUPERMACROS_API_ QJsonLinesReader
+{
+public:
+	/** Read from device, which must be open */
+	explicit QJsonLinesReader(QIODevice* device);
+
+public:
+	/** Read the next object in json. \return false once the device is at its end */
+	bool readNext(QJsonObject& json);
+	/**
+	 * Read up to maxCount lines and append their objects to objects.
+	 * Lines are read in the calling thread, then parsed in the global thread pool if parallel is true
+	 * and the batch is big enough to be worth it. Objects keep the order of the lines.
+	 * \return Number of objects appended, 0 once the device is at its end
+	 */
+	int readBatch(QVector<QJsonObject>& objects, const int maxCount, const bool parallel = true);
+
+	/** True once every line has been read */
+	bool atEnd() const;
+	/** Number of the last line read, starting from 1 */
+	int lineNumber() const { return _lineNumber; }
+	/** Number of lines skipped because they weren't a json object */
+	int invalidLines() const { return _invalidLines; }
+
+private:
+	Q_DISABLE_COPY(QJsonLinesReader)
+
+	bool readLine(QByteArray& line);
+	bool parseLine(const QByteArray& line, QJsonObject& json);
+
+private:
+	QIODevice* _device = nullptr;
+	int _lineNumber = 0;
+	int _invalidLines = 0;
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
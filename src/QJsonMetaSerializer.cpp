@@ -0,0 +1,313 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonMetaSerializer.h>
+#include <QJsonImportExport.h>
+
+#include <QHash>
+#include <QMetaProperty>
+#include <QReadWriteLock>
+#include <QSharedPointer>
+#include <QVector>
+
+#include <cmath>
+#include <limits>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** How a property is converted */
+enum class FieldKind
+{
+	Bool,
+	Int,
+	UInt,
+	Int64,
+	UInt64,
+	Double,
+	String,
+	Object,
+	Variant
+};
+
+/** One serialized property */
+struct MetaField
+{
+	QMetaProperty property;
+	QString key;
+	FieldKind kind;
+	bool writable;
+	/** QQmlDirtyTracker index of the property */
+	int dirtyIndex;
+};
+
+typedef QVector<MetaField> MetaPlan;
+
+static FieldKind fieldKind(const QMetaProperty& property)
+{
+	if (property.isEnumType())
+		return FieldKind::Int;
+
+	const int type = property.userType();
+	switch (type)
+	{
+	case QMetaType::Bool:
+		return FieldKind::Bool;
+	case QMetaType::Int:
+	case QMetaType::Short:
+	case QMetaType::Char:
+	case QMetaType::SChar:
+		return FieldKind::Int;
+	case QMetaType::UInt:
+	case QMetaType::UShort:
+	case QMetaType::UChar:
+		return FieldKind::UInt;
+	case QMetaType::Long:
+		return sizeof(long) > 4 ? FieldKind::Int64 : FieldKind::Int;
+	case QMetaType::ULong:
+		return sizeof(long) > 4 ? FieldKind::UInt64 : FieldKind::UInt;
+	case QMetaType::LongLong:
+		return FieldKind::Int64;
+	case QMetaType::ULongLong:
+		return FieldKind::UInt64;
+	case QMetaType::Float:
+	case QMetaType::Double:
+		return FieldKind::Double;
+	case QMetaType::QString:
+		return FieldKind::String;
+	default:
+		break;
+	}
+	if (QMetaType(type).flags() & QMetaType::PointerToQObject)
+		return FieldKind::Object;
+	return FieldKind::Variant;
+}
+
+static MetaPlan buildPlan(const QMetaObject* meta)
+{
+	MetaPlan plan;
+	const int first = QObject::staticMetaObject.propertyCount();
+	plan.reserve(meta->propertyCount() - first);
+	for (int i = first; i < meta->propertyCount(); ++i)
+	{
+		const QMetaProperty property = meta->property(i);
+		if (!property.isReadable() || !property.isStored())
+			continue;
+		plan.append({ property, QString::fromLatin1(property.name()), fieldKind(property), property.isWritable(), QQmlDirtyTracker::fieldIndex(property.name()) });
+	}
+	return plan;
+}
+
+/** Plan of meta, built the first time the class is serialized */
+static QSharedPointer<const MetaPlan> metaPlan(const QMetaObject* meta)
+{
+	static QReadWriteLock lock;
+	static QHash<const QMetaObject*, QSharedPointer<const MetaPlan>> plans;
+
+	{
+		QReadLocker readLock(&lock);
+		const auto it = plans.constFind(meta);
+		if (it != plans.constEnd())
+			return it.value();
+	}
+
+	const QSharedPointer<const MetaPlan> plan = QSharedPointer<const MetaPlan>::create(buildPlan(meta));
+	QWriteLocker writeLock(&lock);
+	// An other thread may have built it meanwhile, keep the first one
+	const auto it = plans.constFind(meta);
+	if (it != plans.constEnd())
+		return it.value();
+	plans.insert(meta, plan);
+	return plan;
+}
+
+/** Objects being written, from the root to the current one */
+typedef QVector<const QObject*> MetaPath;
+
+/** Deepest QObject nesting written, deeper children are written as null */
+static const int MaxDepth = 256;
+
+/** Push object on path. \return false if it is already being written, ie a parent pointing to its child, or too deep */
+static bool enterObject(MetaPath& path, const QObject* object)
+{
+	if (path.size() >= MaxDepth || path.contains(object))
+	{
+		qWarning("QJsonMetaSerializer : %s is already being written or nested too deep, written as null", object->metaObject()->className());
+		return false;
+	}
+	path.append(object);
+	return true;
+}
+
+static void writeProperties(const QObject* object, QJsonObject& json, MetaPath& path);
+
+static QJsonValue fieldValue(const MetaField& field, const QVariant& value, MetaPath& path)
+{
+	switch (field.kind)
+	{
+	case FieldKind::Bool:
+		return value.toBool();
+	case FieldKind::Int:
+		return value.toInt();
+	case FieldKind::UInt:
+		return double(value.toUInt());
+	case FieldKind::Int64:
+		return qJsonFromInt64(value.toLongLong());
+	case FieldKind::UInt64:
+		return qJsonFromUInt64(value.toULongLong());
+	case FieldKind::Double:
+		return value.toDouble();
+	case FieldKind::String:
+		return value.toString();
+	case FieldKind::Object:
+	{
+		const QObject* child = value.value<QObject*>();
+		if (!child || !enterObject(path, child))
+			return QJsonValue(QJsonValue::Null);
+		QJsonObject childJson;
+		writeProperties(child, childJson, path);
+		path.removeLast();
+		return childJson;
+	}
+	default:
+		return QJsonValue::fromVariant(value);
+	}
+}
+
+/** True if json is an integral number in the range of T, so the cast to T is defined */
+template<typename T>
+static bool isIntegerIn(const QJsonValue& json)
+{
+	if (!json.isDouble())
+		return false;
+	const double number = json.toDouble();
+	return number == std::floor(number) && number >= double(std::numeric_limits<T>::min()) && number <= double(std::numeric_limits<T>::max());
+}
+
+/** Convert json to the type of field. \return Invalid variant if json doesn't have the right type */
+static QVariant fieldVariant(const MetaField& field, const QJsonValue& json)
+{
+	switch (field.kind)
+	{
+	case FieldKind::Bool:
+		return json.isBool() ? QVariant(json.toBool()) : QVariant();
+	case FieldKind::Int:
+		return isIntegerIn<int>(json) ? QVariant(int(json.toDouble())) : QVariant();
+	case FieldKind::UInt:
+		return isIntegerIn<uint>(json) ? QVariant(uint(json.toDouble())) : QVariant();
+	case FieldKind::Int64:
+	{
+		qint64 value = 0;
+		return qJsonToInt64(json, value) ? QVariant(value) : QVariant();
+	}
+	case FieldKind::UInt64:
+	{
+		quint64 value = 0;
+		return qJsonToUInt64(json, value) ? QVariant(value) : QVariant();
+	}
+	case FieldKind::Double:
+		return json.isDouble() ? QVariant(json.toDouble()) : QVariant();
+	case FieldKind::String:
+		return json.isString() ? QVariant(json.toString()) : QVariant();
+	default:
+		return json.isNull() || json.isUndefined() ? QVariant() : json.toVariant();
+	}
+}
+
+/** Write the properties of object, already on path */
+static void writeProperties(const QObject* object, QJsonObject& json, MetaPath& path)
+{
+	const QSharedPointer<const MetaPlan> plan = metaPlan(object->metaObject());
+	for (const MetaField& field : *plan)
+		json.insert(field.key, fieldValue(field, field.property.read(object), path));
+}
+
+/** Write object from StartObject to EndObject, or null if it is nullptr or can't enter path */
+static void streamObject(const QObject* object, QJsonStreamWriter& writer, MetaPath& path)
+{
+	if (!object || !enterObject(path, object))
+	{
+		writer.writeNull();
+		return;
+	}
+
+	writer.writeStartObject();
+	const QSharedPointer<const MetaPlan> plan = metaPlan(object->metaObject());
+	for (const MetaField& field : *plan)
+	{
+		writer.writeName(field.key);
+		if (field.kind == FieldKind::Object)
+			streamObject(field.property.read(object).value<QObject*>(), writer, path);
+		else
+			writer.writeValue(fieldValue(field, field.property.read(object), path));
+	}
+	writer.writeEndObject();
+	path.removeLast();
+}
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+void QJsonMetaSerializer::write(const QObject* object, QJsonObject& json)
+{
+	if (!object)
+		return;
+
+	MetaPath path;
+	path.append(object);
+	writeProperties(object, json, path);
+}
+
+void QJsonMetaSerializer::write(const QObject* object, QJsonStreamWriter& writer)
+{
+	MetaPath path;
+	streamObject(object, writer, path);
+}
+
+void QJsonMetaSerializer::writeDirty(const QObject* object, const QQmlDirtyTracker& tracker, QJsonObject& json)
+{
+	if (!object)
+		return;
+
+	MetaPath path;
+	path.append(object);
+	const QSharedPointer<const MetaPlan> plan = metaPlan(object->metaObject());
+	for (const MetaField& field : *plan)
+	{
+		if (tracker.isDirty(field.dirtyIndex))
+			json.insert(field.key, fieldValue(field, field.property.read(object), path));
+	}
+}
+
+void QJsonMetaSerializer::read(QObject* object, const QJsonObject& json)
+{
+	if (!object)
+		return;
+
+	const QSharedPointer<const MetaPlan> plan = metaPlan(object->metaObject());
+	for (const MetaField& field : *plan)
+	{
+		const auto it = json.constFind(field.key);
+		if (it == json.constEnd())
+			continue;
+
+		// The existing child is filled, even through a read only pointer property
+		if (field.kind == FieldKind::Object)
+		{
+			if (it.value().isObject())
+				read(field.property.read(object).value<QObject*>(), it.value().toObject());
+			continue;
+		}
+
+		if (!field.writable)
+			continue;
+		const QVariant value = fieldVariant(field, it.value());
+		if (value.isValid())
+			field.property.write(object, value);
+	}
+}
@@ -0,0 +1,86 @@
+/**
+ * \file QJsonMetaSerializer.h
+ * \brief Serialize the properties of any QObject through its QMetaObject
+ */
+#ifndef __QJSON_META_SERIALIZER_HPP__
+#define __QJSON_META_SERIALIZER_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+
+// Qt Header
+#include <QJsonObject>
+#include <QObject>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+#include <QQmlDirtyTracker.h>
+#include <QJsonStreamWriter.h>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Implement jsonWrite() and jsonRead() of a QObject and QJsonImportExport class with QJsonMetaSerializer.
+ * Properties are read independently, so jsonReadPatch() only read the diff.
+ * Every stored property, QSM_*_PROPERTY included, is serialized with its name as json key.
+ *
+ * \code
+ * class MyObject : public QObject, public QJsonImportExport
+ * {
+ *     Q_OBJECT
+ *     QJSONMETA_IMPORTEXPORT
+ *     QSM_WRITABLE_AUTO_PROPERTY(int, x, X);
+ * };
+ * \endcode
+ */
+#define QJSONMETA_IMPORTEXPORT \
+public: \
+	void jsonWrite(QJsonObject& json) const override { QSUPERMACROS_NAMESPACE::QJsonMetaSerializer::write(this, json); } \
+	void jsonStreamWrite(QSUPERMACROS_NAMESPACE::QJsonStreamWriter& writer) const override { QSUPERMACROS_NAMESPACE::QJsonMetaSerializer::write(this, writer); } \
+	void jsonRead(const QJsonObject& json) override { QSUPERMACROS_NAMESPACE::QJsonMetaSerializer::read(this, json); } \
+	void jsonReadPatch(const QJsonObject& diff, const QJsonObject&) override { jsonRead(diff); } \
+	bool jsonWriteDirty(const QSUPERMACROS_NAMESPACE::QQmlDirtyTracker& tracker, QJsonObject& json) const override { QSUPERMACROS_NAMESPACE::QJsonMetaSerializer::writeDirty(this, tracker, json); return true; } \
+private:
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Generic serializer for the stored properties of a QObject, QObject's own properties excluded.
+ * The properties of a class are walked once : key, type and converter are cached in a plan per QMetaObject,
+ * so following serializations never look up or build any string.
+ *
+ * * 64 bits integers are written as strings, like QJSONEXPORT_INT64.
+ * * Enums are written as integers.
+ * * QObject pointers are serialized recursively, and read into the existing object.
+ *   A pointer back to an object being written, or nested deeper than 256 objects, is written as null.
+ * * Other types go through QJsonValue::fromVariant() and QJsonValue::toVariant().
+ */
+class QSUPERMACROS_API_ QJsonMetaSerializer
+{
+public:
+	/** Write the properties of object in json */
+	static void write(const QObject* object, QJsonObject& json);
+	/** Write object as a whole json object, from StartObject to EndObject */
+	static void write(const QObject* object, QJsonStreamWriter& writer);
+	/** Write the properties of object that are dirty in tracker, see QJsonExportable::jsonWritePatch() */
+	static void writeDirty(const QObject* object, const QQmlDirtyTracker& tracker, QJsonObject& json);
+	/** Write the writable properties of object that are present in json with the right type */
+	static void read(QObject* object, const QJsonObject& json);
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
@@ -0,0 +1,153 @@
+/**
+ * \file QJsonParallel.h
+ * \brief Export and import big object arrays in the global thread pool
+ *
+ * Kept out of QJsonImportExport.h so only the files using it pull QtConcurrent.
+ *
+ * jsonWrite() and jsonRead() of the elements run in worker threads, so do their getters and setters:
+ * * A QQmlNotifyBatch opened by the caller doesn't cover them, each setter emits on its own, from the worker.
+ * * Deferred properties queue their signal in the thread of the element and read the value there,
+ *   while other workers may still be writing it.
+ * * Signals reach the slots of other threads through queued connections, with their value at emit time.
+ * Import into elements that aren't shared yet (ie not exposed to QML), and open batches inside jsonRead() if needed.
+ */
+#ifndef __QJSON_PARALLEL_HPP__
+#define __QJSON_PARALLEL_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+
+// Qt Header
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QVector>
+#include <QtConcurrent>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+#include <QJsonImportExport.h>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+/** Same as QJSONEXPORT_ARRAY_OBJECT, with the elements exported in parallel. See qJsonExportArrayParallel() */
+#define QJSONEXPORT_ARRAY_OBJECT_PARALLEL(jsonName, list) \
+	QJSONEXPORT(jsonName, QSUPERMACROS_NAMESPACE::qJsonExportArrayParallel(list)) \
+
+/** Read each object of the array into the existing element of list at the same index, in parallel. See qJsonImportArrayParallel() */
+#define QJSONIMPORT_ARRAY_OBJECT_PARALLEL_WLOG(jsonName, list, logCat) \
+{ \
+	if (const auto _jsonArrayField = QJSONIMPORT_FIELD(jsonName, Array)) \
+	{ \
+		QSUPERMACROS_NAMESPACE::qJsonImportArrayParallel(_jsonArrayField.value().toArray(), list); \
+	} \
+	else \
+	{ \
+		qCDebug(logCat, "%s isn't a valid Json Array", qPrintable(jsonName)); \
+	} \
+}
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					HELPERS
+// ─────────────────────────────────────────────────────────────
+
+/** Range [begin, end[ of elements handled by one task */
+struct QJsonParallelRange
+{
+	int begin;
+	int end;
+};
+
+/** Cut count elements in ranges of chunkSize */
+inline QVector<QJsonParallelRange> qJsonParallelRanges(const int count, const int chunkSize)
+{
+	QVector<QJsonParallelRange> ranges;
+	ranges.reserve(count / chunkSize + 1);
+	for (int begin = 0; begin < count; begin += chunkSize)
+		ranges.append({ begin, qMin(begin + chunkSize, count) });
+	return ranges;
+}
+
+/**
+ * Call jsonWrite() of every element of list, chunkSize elements per task of the global thread pool.
+ * Results are joined in order. Lists smaller than a chunk are exported in the calling thread.
+ * Elements must not be modified while exporting.
+ * \return Json array with one object per element
+ */
+template<typename List>
+QJsonArray qJsonExportArrayParallel(const List& list, const int chunkSize = 1024)
+{
+	const int count = int(list.size());
+	QVector<QJsonObject> objects(count);
+
+	if (count <= chunkSize)
+	{
+		for (int i = 0; i < count; ++i)
+			list[i]->jsonWrite(objects[i]);
+	}
+	else
+	{
+		QVector<QJsonParallelRange> ranges = qJsonParallelRanges(count, chunkSize);
+		QtConcurrent::blockingMap(ranges, [&list, &objects](const QJsonParallelRange& range)
+		{
+			for (int i = range.begin; i < range.end; ++i)
+				list[i]->jsonWrite(objects[i]);
+		});
+	}
+
+	QJsonArray array;
+	for (const QJsonObject& object : objects)
+		array.append(object);
+	return array;
+}
+
+/**
+ * Call jsonRead() of list[i] with array[i], chunkSize elements per task of the global thread pool.
+ * Elements that aren't objects are skipped, extra elements of array or list are ignored.
+ * jsonRead() is called from worker threads : only use it on objects that aren't shared yet (ie not exposed to QML).
+ * \return Number of elements read
+ */
+template<typename List>
+int qJsonImportArrayParallel(const QJsonArray& array, const List& list, const int chunkSize = 1024)
+{
+	const int count = qMin(array.size(), int(list.size()));
+	QAtomicInt read(0);
+
+	const auto readRange = [&array, &list, &read](const QJsonParallelRange& range)
+	{
+		int rangeRead = 0;
+		for (int i = range.begin; i < range.end; ++i)
+		{
+			const QJsonValue value = array.at(i);
+			if (value.isObject())
+			{
+				list[i]->jsonRead(value.toObject());
+				++rangeRead;
+			}
+		}
+		read.fetchAndAddRelaxed(rangeRead);
+	};
+
+	if (count <= chunkSize)
+		readRange({ 0, count });
+	else
+	{
+		QVector<QJsonParallelRange> ranges = qJsonParallelRanges(count, chunkSize);
+		QtConcurrent::blockingMap(ranges, readRange);
+	}
+	return read.load();
+}
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
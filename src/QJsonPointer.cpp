@@ -0,0 +1,183 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonPointer.h>
+
+#include <QJsonArray>
+#include <QJsonObject>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Array index of token as defined by RFC 6901 : digits without leading zero. \return -1 if it isn't an index */
+static int arrayIndex(const QString& token)
+{
+	if (token.isEmpty() || (token.size() > 1 && token.at(0) == QLatin1Char('0')))
+		return -1;
+	for (const QChar c : token)
+	{
+		if (c < QLatin1Char('0') || c > QLatin1Char('9'))
+			return -1;
+	}
+	bool ok = false;
+	const int index = token.toInt(&ok);
+	return ok ? index : -1;
+}
+
+/** State of QJsonPointer::select() */
+struct PointerSelection
+{
+	const QVector<QJsonPointer>& pointers;
+	QVector<QJsonValue> values;
+	int remaining;
+};
+
+/**
+ * Visit the value the reader is positioned on, at path level.
+ * candidates are the pointers whose first level tokens match the path.
+ * \return false on syntax error
+ */
+static bool selectValue(QJsonStreamReader& reader, PointerSelection& selection, const int level, const QVector<int>& candidates)
+{
+	// A pointer end here : build this value only, deeper pointers are resolved in it
+	for (const int candidate : candidates)
+	{
+		if (selection.pointers.at(candidate).size() != level)
+			continue;
+
+		const QJsonValue value = reader.readValue();
+		if (value.isUndefined())
+			return false;
+		for (const int other : candidates)
+		{
+			if (selection.values.at(other).isUndefined())
+			{
+				selection.values[other] = selection.pointers.at(other).resolve(value, level);
+				--selection.remaining;
+			}
+		}
+		return true;
+	}
+
+	const QJsonStreamReader::TokenType token = reader.tokenType();
+	if (token == QJsonStreamReader::StartObject)
+	{
+		QVector<int> members;
+		while (selection.remaining && reader.readNext() == QJsonStreamReader::Name)
+		{
+			members.clear();
+			for (const int candidate : candidates)
+			{
+				if (selection.values.at(candidate).isUndefined() && selection.pointers.at(candidate).tokens().at(level) == reader.name())
+					members.append(candidate);
+			}
+
+			if (members.isEmpty())
+			{
+				if (!reader.skipValue())
+					return false;
+			}
+			else if (reader.readNext() == QJsonStreamReader::Invalid || !selectValue(reader, selection, level + 1, members))
+				return false;
+		}
+		return !reader.hasError();
+	}
+
+	if (token == QJsonStreamReader::StartArray)
+	{
+		QVector<int> elements;
+		for (int index = 0; selection.remaining; ++index)
+		{
+			const QJsonStreamReader::TokenType element = reader.readNext();
+			if (element == QJsonStreamReader::EndArray)
+				break;
+			if (element == QJsonStreamReader::Invalid)
+				return false;
+
+			elements.clear();
+			for (const int candidate : candidates)
+			{
+				if (selection.values.at(candidate).isUndefined() && selection.pointers.at(candidate).index(level) == index)
+					elements.append(candidate);
+			}
+
+			if (elements.isEmpty() ? !reader.skipValue() : !selectValue(reader, selection, level + 1, elements))
+				return false;
+		}
+		return true;
+	}
+
+	// Scalar, deeper pointers can't match
+	return !reader.hasError();
+}
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+QJsonPointer::QJsonPointer(const QString& pointer)
+{
+	if (pointer.isEmpty())
+		return;
+	if (!pointer.startsWith(QLatin1Char('/')))
+	{
+		_valid = false;
+		return;
+	}
+
+	_tokens = pointer.mid(1).split(QLatin1Char('/'));
+	_indexes.reserve(_tokens.size());
+	for (QString& token : _tokens)
+	{
+		// ~1 first, so "~01" give "~1" and not "/"
+		token.replace(QLatin1String("~1"), QLatin1String("/"));
+		token.replace(QLatin1String("~0"), QLatin1String("~"));
+		_indexes.append(arrayIndex(token));
+	}
+}
+
+QJsonValue QJsonPointer::resolve(const QJsonValue& value, const int level) const
+{
+	if (!_valid)
+		return QJsonValue(QJsonValue::Undefined);
+	if (level == _tokens.size())
+		return value;
+
+	if (value.isObject())
+	{
+		const QJsonObject object = value.toObject();
+		const auto it = object.constFind(_tokens.at(level));
+		return it != object.constEnd() ? resolve(it.value(), level + 1) : QJsonValue(QJsonValue::Undefined);
+	}
+	if (value.isArray())
+	{
+		const QJsonArray array = value.toArray();
+		const int index = _indexes.at(level);
+		return index >= 0 && index < array.size() ? resolve(array.at(index), level + 1) : QJsonValue(QJsonValue::Undefined);
+	}
+	return QJsonValue(QJsonValue::Undefined);
+}
+
+QVector<QJsonValue> QJsonPointer::select(QJsonStreamReader& reader, const QVector<QJsonPointer>& pointers)
+{
+	PointerSelection selection{ pointers, QVector<QJsonValue>(pointers.size(), QJsonValue(QJsonValue::Undefined)), 0 };
+	QVector<int> candidates;
+	candidates.reserve(pointers.size());
+	for (int i = 0; i < pointers.size(); ++i)
+	{
+		if (pointers.at(i).isValid())
+			candidates.append(i);
+	}
+	selection.remaining = candidates.size();
+
+	const QJsonStreamReader::TokenType root = reader.readNext();
+	if (root == QJsonStreamReader::Invalid || root == QJsonStreamReader::EndDocument)
+		return QVector<QJsonValue>();
+	if (!candidates.isEmpty() && !selectValue(reader, selection, 0, candidates))
+		return QVector<QJsonValue>();
+	return selection.values;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file QJsonPointer.h
+ * \brief Json Pointer (RFC 6901) and selection of subtrees while streaming
+ */
+#ifndef __QJSON_POINTER_HPP__
+#define __QJSON_POINTER_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+
+// Qt Header
+#include <QJsonValue>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+#include <QJsonStreamReader.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Path to a value in a json document, like "/devices/42/calibration".
+ * The empty pointer "" is the whole document. "~1" and "~0" escape '/' and '~' in member names.
+ */
+class QSUPERMACROS_API_ QJsonPointer
+{
+public:
+	QJsonPointer() = default;
+	/** Parse pointer. The pointer is invalid if it isn't empty and doesn't start with '/' */
+	explicit QJsonPointer(const QString& pointer);
+
+public:
+	/** True if the pointer was well formed */
+	bool isValid() const { return _valid; }
+	/** Unescaped reference tokens */
+	const QStringList& tokens() const { return _tokens; }
+	/** Array index of the token at level, -1 if it can only be a member name */
+	int index(const int level) const { return _indexes.at(level); }
+	/** Number of reference tokens */
+	int size() const { return _tokens.size(); }
+
+	/** Resolve the tokens from level in an already built value, value being the one at level. \return Undefined if not found */
+	QJsonValue resolve(const QJsonValue& value, const int level = 0) const;
+
+	/**
+	 * Read from reader only the values pointed by pointers, in a single pass.
+	 * Unrelated members and elements are skipped at tokenizer speed without being decoded,
+	 * and reading stop as soon as every pointer is resolved, so the end of the document may never be read.
+	 * The reader must be at the start of the document.
+	 * \return One value per pointer, Undefined if not found. Empty on syntax error
+	 */
+	static QVector<QJsonValue> select(QJsonStreamReader& reader, const QVector<QJsonPointer>& pointers);
+
+private:
+	QStringList _tokens;
+	QVector<int> _indexes;
+	bool _valid = true;
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
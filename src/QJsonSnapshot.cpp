@@ -0,0 +1,502 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonSnapshot.h>
+
+#include <QHash>
+#include <QVector>
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+static const char SnapshotMagic[] = "QSMS";
+static const quint32 SnapshotVersion = 1;
+static const quint32 HeaderSize = 16;
+/** Count and reserved of array and object records */
+static const quint32 RecordHeaderSize = 8;
+/** Type, reserved or key offset, and payload */
+static const quint32 SlotSize = 16;
+
+static quint32 readUInt32(const char* data)
+{
+	return qFromLittleEndian<quint32>(reinterpret_cast<const uchar*>(data));
+}
+
+static quint64 readUInt64(const char* data)
+{
+	return qFromLittleEndian<quint64>(reinterpret_cast<const uchar*>(data));
+}
+
+static ushort readUtf16(const char* data)
+{
+	return qFromLittleEndian<quint16>(reinterpret_cast<const uchar*>(data));
+}
+
+/** True if [offset, offset + length[ is inside a buffer of size */
+static bool inBounds(const quint32 size, const quint32 offset, const quint64 length)
+{
+	return offset <= size && length <= size - offset;
+}
+
+/** Length of the string at offset, 0 and units set to nullptr if it is out of bounds */
+static quint32 stringAt(const char* base, const quint32 size, const quint32 offset, const char*& units)
+{
+	units = nullptr;
+	if (!inBounds(size, offset, 4))
+		return 0;
+	const quint32 length = readUInt32(base + offset);
+	if (!inBounds(size, offset + 4, quint64(length) * 2))
+		return 0;
+	units = base + offset + 4;
+	return length;
+}
+
+static QString decodeString(const char* units, const quint32 length)
+{
+	if (!units)
+		return QString();
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+	return QString(reinterpret_cast<const QChar*>(units), int(length));
+#else
+	QString string(int(length), Qt::Uninitialized);
+	QChar* out = string.data();
+	for (quint32 i = 0; i < length; ++i)
+		out[i] = QChar(readUtf16(units + 2 * i));
+	return string;
+#endif
+}
+
+static ushort keyUnit(const QString& key, const int index) { return key.at(index).unicode(); }
+static ushort keyUnit(const QLatin1String& key, const int index) { return uchar(key.data()[index]); }
+
+/** Compare the snapshot string with key in code units order, like QString::compare() */
+template<typename Key>
+static int compareKey(const char* units, const quint32 length, const Key& key)
+{
+	const int keySize = key.size();
+	const int common = qMin(int(length), keySize);
+	for (int i = 0; i < common; ++i)
+	{
+		const ushort unit = readUtf16(units + 2 * i);
+		const ushort other = keyUnit(key, i);
+		if (unit != other)
+			return unit < other ? -1 : 1;
+	}
+	return int(length) - keySize;
+}
+
+/** Build a snapshot in post order, so every record is written before the slot pointing to it */
+class SnapshotBuilder
+{
+public:
+	QByteArray build(const QJsonObject& json)
+	{
+		_data.clear();
+		_data.append(SnapshotMagic, 4);
+		appendUInt32(SnapshotVersion);
+		appendUInt32(0);
+		appendUInt32(0);
+
+		const quint32 root = writeObject(json);
+		qToLittleEndian<quint32>(root, reinterpret_cast<uchar*>(_data.data() + 8));
+		return _data;
+	}
+
+private:
+	struct Slot
+	{
+		quint32 type;
+		quint64 payload;
+	};
+
+	void align(const int alignment)
+	{
+		while (_data.size() % alignment)
+			_data.append('\0');
+	}
+
+	void appendUInt32(const quint32 value)
+	{
+		uchar bytes[4];
+		qToLittleEndian<quint32>(value, bytes);
+		_data.append(reinterpret_cast<const char*>(bytes), 4);
+	}
+
+	void appendUInt64(const quint64 value)
+	{
+		uchar bytes[8];
+		qToLittleEndian<quint64>(value, bytes);
+		_data.append(reinterpret_cast<const char*>(bytes), 8);
+	}
+
+	quint32 writeString(const QString& string)
+	{
+		align(4);
+		const quint32 offset = quint32(_data.size());
+		appendUInt32(quint32(string.size()));
+		for (const QChar c : string)
+		{
+			uchar bytes[2];
+			qToLittleEndian<quint16>(c.unicode(), bytes);
+			_data.append(reinterpret_cast<const char*>(bytes), 2);
+		}
+		return offset;
+	}
+
+	/** Keys are written once and shared by every object using them */
+	quint32 writeKey(const QString& key)
+	{
+		const auto it = _keys.constFind(key);
+		if (it != _keys.constEnd())
+			return it.value();
+		const quint32 offset = writeString(key);
+		_keys.insert(key, offset);
+		return offset;
+	}
+
+	Slot writeValue(const QJsonValue& value)
+	{
+		switch (value.type())
+		{
+		case QJsonValue::Bool:
+			return { QJsonValue::Bool, quint64(value.toBool()) };
+		case QJsonValue::Double:
+		{
+			const double number = value.toDouble();
+			quint64 bits;
+			memcpy(&bits, &number, sizeof(bits));
+			return { QJsonValue::Double, bits };
+		}
+		case QJsonValue::String:
+			return { QJsonValue::String, writeString(value.toString()) };
+		case QJsonValue::Array:
+			return { QJsonValue::Array, writeArray(value.toArray()) };
+		case QJsonValue::Object:
+			return { QJsonValue::Object, writeObject(value.toObject()) };
+		default:
+			return { QJsonValue::Null, 0 };
+		}
+	}
+
+	quint32 writeArray(const QJsonArray& array)
+	{
+		QVector<Slot> elements;
+		elements.reserve(array.size());
+		for (const QJsonValue& value : array)
+			elements.append(writeValue(value));
+
+		align(8);
+		const quint32 offset = quint32(_data.size());
+		appendUInt32(quint32(elements.size()));
+		appendUInt32(0);
+		for (const Slot& slot : elements)
+		{
+			appendUInt32(slot.type);
+			appendUInt32(0);
+			appendUInt64(slot.payload);
+		}
+		return offset;
+	}
+
+	quint32 writeObject(const QJsonObject& object)
+	{
+		// Lookups are binary searches in code units order
+		QStringList keys = object.keys();
+		std::sort(keys.begin(), keys.end());
+
+		QVector<QPair<quint32, Slot>> members;
+		members.reserve(keys.size());
+		for (const QString& key : keys)
+			members.append(qMakePair(writeKey(key), writeValue(object.value(key))));
+
+		align(8);
+		const quint32 offset = quint32(_data.size());
+		appendUInt32(quint32(members.size()));
+		appendUInt32(0);
+		for (const auto& member : members)
+		{
+			appendUInt32(member.first);
+			appendUInt32(member.second.type);
+			appendUInt64(member.second.payload);
+		}
+		return offset;
+	}
+
+private:
+	QByteArray _data;
+	QHash<QString, quint32> _keys;
+};
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+QJsonValue::Type QJsonSnapshotValue::type() const
+{
+	switch (_type)
+	{
+	case QJsonValue::Null:
+	case QJsonValue::Bool:
+	case QJsonValue::Double:
+	case QJsonValue::String:
+	case QJsonValue::Array:
+	case QJsonValue::Object:
+		return QJsonValue::Type(_type);
+	default:
+		return QJsonValue::Undefined;
+	}
+}
+
+bool QJsonSnapshotValue::toBool(const bool defaultValue) const
+{
+	return _type == QJsonValue::Bool ? _payload != 0 : defaultValue;
+}
+
+double QJsonSnapshotValue::toDouble(const double defaultValue) const
+{
+	if (_type != QJsonValue::Double)
+		return defaultValue;
+	double number;
+	memcpy(&number, &_payload, sizeof(number));
+	return number;
+}
+
+int QJsonSnapshotValue::toInt(const int defaultValue) const
+{
+	// Same rule as QJsonValue::toInt() : only doubles holding an int are converted
+	const double number = toDouble(0.5);
+	if (number < std::numeric_limits<int>::min() || number > std::numeric_limits<int>::max() || int(number) != number)
+		return defaultValue;
+	return int(number);
+}
+
+QString QJsonSnapshotValue::toString() const
+{
+	if (_type != QJsonValue::String || _payload > std::numeric_limits<quint32>::max())
+		return QString();
+	const char* units;
+	const quint32 length = stringAt(_base, _size, quint32(_payload), units);
+	return decodeString(units, length);
+}
+
+QJsonSnapshotArray QJsonSnapshotValue::toArray() const
+{
+	// Children are written before their parent, anything else is a cycle
+	if (_type != QJsonValue::Array || _payload >= _parent)
+		return QJsonSnapshotArray();
+	return QJsonSnapshotArray(_base, _size, quint32(_payload));
+}
+
+QJsonSnapshotObject QJsonSnapshotValue::toObject() const
+{
+	if (_type != QJsonValue::Object || _payload >= _parent)
+		return QJsonSnapshotObject();
+	return QJsonSnapshotObject(_base, _size, quint32(_payload));
+}
+
+QJsonValue QJsonSnapshotValue::toJsonValue() const
+{
+	switch (type())
+	{
+	case QJsonValue::Null:
+		return QJsonValue(QJsonValue::Null);
+	case QJsonValue::Bool:
+		return toBool();
+	case QJsonValue::Double:
+		return toDouble();
+	case QJsonValue::String:
+		return toString();
+	case QJsonValue::Array:
+		return toArray().toJsonArray();
+	case QJsonValue::Object:
+		return toObject().toJsonObject();
+	default:
+		return QJsonValue(QJsonValue::Undefined);
+	}
+}
+
+QJsonSnapshotArray::QJsonSnapshotArray(const char* base, const quint32 size, const quint32 offset)
+{
+	if (!inBounds(size, offset, RecordHeaderSize))
+		return;
+	const quint32 count = readUInt32(base + offset);
+	if (!inBounds(size, offset + RecordHeaderSize, quint64(count) * SlotSize))
+		return;
+
+	_base = base;
+	_size = size;
+	_offset = offset;
+	_count = count;
+}
+
+QJsonSnapshotValue QJsonSnapshotArray::at(const int index) const
+{
+	if (index < 0 || quint32(index) >= _count)
+		return QJsonSnapshotValue();
+	const char* slot = _base + _offset + RecordHeaderSize + quint32(index) * SlotSize;
+	return QJsonSnapshotValue(_base, _size, _offset, readUInt32(slot), readUInt64(slot + 8));
+}
+
+QJsonArray QJsonSnapshotArray::toJsonArray() const
+{
+	QJsonArray array;
+	for (const QJsonSnapshotValue& value : *this)
+		array.append(value.toJsonValue());
+	return array;
+}
+
+QJsonSnapshotObject::QJsonSnapshotObject(const char* base, const quint32 size, const quint32 offset)
+{
+	if (!inBounds(size, offset, RecordHeaderSize))
+		return;
+	const quint32 count = readUInt32(base + offset);
+	if (!inBounds(size, offset + RecordHeaderSize, quint64(count) * SlotSize))
+		return;
+
+	_base = base;
+	_size = size;
+	_offset = offset;
+	_count = count;
+}
+
+template<typename Key>
+QJsonSnapshotValue QJsonSnapshotObject::find(const Key& key) const
+{
+	quint32 low = 0;
+	quint32 high = _count;
+	while (low < high)
+	{
+		const quint32 middle = low + (high - low) / 2;
+		const char* member = _base + _offset + RecordHeaderSize + middle * SlotSize;
+		const char* units;
+		const quint32 length = stringAt(_base, _size, readUInt32(member), units);
+		if (!units)
+			return QJsonSnapshotValue();
+
+		const int comparison = compareKey(units, length, key);
+		if (!comparison)
+			return QJsonSnapshotValue(_base, _size, _offset, readUInt32(member + 4), readUInt64(member + 8));
+		if (comparison < 0)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return QJsonSnapshotValue();
+}
+
+QJsonSnapshotValue QJsonSnapshotObject::value(const QString& key) const
+{
+	return find(key);
+}
+
+QJsonSnapshotValue QJsonSnapshotObject::value(const QLatin1String& key) const
+{
+	return find(key);
+}
+
+QString QJsonSnapshotObject::keyAt(const int index) const
+{
+	if (index < 0 || quint32(index) >= _count)
+		return QString();
+	const char* units;
+	const quint32 length = stringAt(_base, _size, readUInt32(_base + _offset + RecordHeaderSize + quint32(index) * SlotSize), units);
+	return decodeString(units, length);
+}
+
+QJsonSnapshotValue QJsonSnapshotObject::valueAt(const int index) const
+{
+	if (index < 0 || quint32(index) >= _count)
+		return QJsonSnapshotValue();
+	const char* member = _base + _offset + RecordHeaderSize + quint32(index) * SlotSize;
+	return QJsonSnapshotValue(_base, _size, _offset, readUInt32(member + 4), readUInt64(member + 8));
+}
+
+QJsonObject QJsonSnapshotObject::toJsonObject() const
+{
+	QJsonObject object;
+	for (int i = 0; i < size(); ++i)
+		object.insert(keyAt(i), valueAt(i).toJsonValue());
+	return object;
+}
+
+QJsonSnapshot::~QJsonSnapshot()
+{
+	close();
+}
+
+bool QJsonSnapshot::open(const QString& filepath)
+{
+	close();
+	_file.setFileName(filepath);
+	if (!_file.open(QIODevice::ReadOnly))
+		return false;
+
+	const qint64 size = _file.size();
+	const uchar* mapped = size > 0 ? _file.map(0, size) : nullptr;
+	if (!mapped || !setBase(reinterpret_cast<const char*>(mapped), size))
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+bool QJsonSnapshot::setData(const QByteArray& data)
+{
+	close();
+	_data = data;
+	if (!setBase(_data.constData(), _data.size()))
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void QJsonSnapshot::close()
+{
+	// Unmapped by QFile::close()
+	_file.close();
+	_data.clear();
+	_base = nullptr;
+	_size = 0;
+	_root = 0;
+}
+
+bool QJsonSnapshot::setBase(const char* base, const qint64 size)
+{
+	if (size < HeaderSize || size > std::numeric_limits<quint32>::max()
+		|| memcmp(base, SnapshotMagic, 4) || readUInt32(base + 4) != SnapshotVersion)
+		return false;
+
+	_base = base;
+	_size = quint32(size);
+	_root = readUInt32(base + 8);
+	return true;
+}
+
+QJsonSnapshotObject QJsonSnapshot::root() const
+{
+	if (!_base)
+		return QJsonSnapshotObject();
+	return QJsonSnapshotObject(_base, _size, _root);
+}
+
+QByteArray QJsonSnapshot::fromJson(const QJsonObject& json)
+{
+	return SnapshotBuilder().build(json);
+}
+
+bool QJsonSnapshot::isSnapshot(const QByteArray& data)
+{
+	return data.size() >= int(HeaderSize) && data.startsWith(SnapshotMagic);
+}
@@ -0,0 +1,252 @@
+/**
+ * \file QJsonSnapshot.h
+ * \brief Binary json snapshot read in place from a mapped file
+ */
+#ifndef __QJSON_SNAPSHOT_HPP__
+#define __QJSON_SNAPSHOT_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+#include <iterator>
+
+// Qt Header
+#include <QByteArray>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+class QJsonSnapshotArray;
+class QJsonSnapshotObject;
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * View of a value inside a snapshot, with the same accessors as QJsonValue.
+ * Scalars are read in place, strings are copied on toString() only.
+ * Views are only valid while their QJsonSnapshot is open.
+ */
+class QSUPERMACROS_API_ QJsonSnapshotValue
+{
+public:
+	/** Undefined value */
+	QJsonSnapshotValue() = default;
+	/** Value stored in the record at parent, the offset of its array or object */
+	QJsonSnapshotValue(const char* base, const quint32 size, const quint32 parent, const quint32 type, const quint64 payload) :
+		_base(base), _size(size), _parent(parent), _type(type), _payload(payload) {}
+
+public:
+	QJsonValue::Type type() const;
+	bool isNull() const { return type() == QJsonValue::Null; }
+	bool isBool() const { return type() == QJsonValue::Bool; }
+	bool isDouble() const { return type() == QJsonValue::Double; }
+	bool isString() const { return type() == QJsonValue::String; }
+	bool isArray() const { return type() == QJsonValue::Array; }
+	bool isObject() const { return type() == QJsonValue::Object; }
+	bool isUndefined() const { return type() == QJsonValue::Undefined; }
+
+	bool toBool(const bool defaultValue = false) const;
+	double toDouble(const double defaultValue = 0) const;
+	int toInt(const int defaultValue = 0) const;
+	QString toString() const;
+	QJsonSnapshotArray toArray() const;
+	QJsonSnapshotObject toObject() const;
+	/** Deep copy as a QJsonValue */
+	QJsonValue toJsonValue() const;
+
+private:
+	const char* _base = nullptr;
+	quint32 _size = 0;
+	quint32 _parent = 0;
+	quint32 _type = QJsonValue::Undefined;
+	quint64 _payload = 0;
+};
+
+/** View of an array inside a snapshot, with the same accessors as QJsonArray */
+class QSUPERMACROS_API_ QJsonSnapshotArray
+{
+public:
+	/** Iterate over the elements, in a range based for */
+	class const_iterator
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef QJsonSnapshotValue value_type;
+		typedef int difference_type;
+		typedef const QJsonSnapshotValue* pointer;
+		typedef QJsonSnapshotValue reference;
+
+		const_iterator(const QJsonSnapshotArray* array, const int index) : _array(array), _index(index) {}
+		QJsonSnapshotValue operator*() const { return _array->at(_index); }
+		const_iterator& operator++() { ++_index; return *this; }
+		bool operator==(const const_iterator& other) const { return _index == other._index; }
+		bool operator!=(const const_iterator& other) const { return _index != other._index; }
+
+	private:
+		const QJsonSnapshotArray* _array;
+		int _index;
+	};
+
+	/** Empty array */
+	QJsonSnapshotArray() = default;
+	/** View of the array record at offset of base. An out of bounds record give an empty array */
+	QJsonSnapshotArray(const char* base, const quint32 size, const quint32 offset);
+
+public:
+	int size() const { return int(_count); }
+	bool isEmpty() const { return !_count; }
+	/** Element at index, Undefined if out of range */
+	QJsonSnapshotValue at(const int index) const;
+	QJsonSnapshotValue operator[](const int index) const { return at(index); }
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, size()); }
+	/** Deep copy as a QJsonArray */
+	QJsonArray toJsonArray() const;
+
+private:
+	const char* _base = nullptr;
+	quint32 _size = 0;
+	quint32 _offset = 0;
+	quint32 _count = 0;
+};
+
+/**
+ * View of an object inside a snapshot, with the same accessors as QJsonObject.
+ * Members are sorted by key, a lookup is a binary search comparing the keys in place.
+ */
+class QSUPERMACROS_API_ QJsonSnapshotObject
+{
+public:
+	/** Empty object */
+	QJsonSnapshotObject() = default;
+	/** View of the object record at offset of base. An out of bounds record give an empty object */
+	QJsonSnapshotObject(const char* base, const quint32 size, const quint32 offset);
+
+public:
+	int size() const { return int(_count); }
+	bool isEmpty() const { return !_count; }
+	/** Value of key, Undefined if not found */
+	QJsonSnapshotValue value(const QString& key) const;
+	/** Value of key, without building a QString */
+	QJsonSnapshotValue value(const QLatin1String& key) const;
+	QJsonSnapshotValue operator[](const QString& key) const { return value(key); }
+	QJsonSnapshotValue operator[](const QLatin1String& key) const { return value(key); }
+	bool contains(const QString& key) const { return !value(key).isUndefined(); }
+	bool contains(const QLatin1String& key) const { return !value(key).isUndefined(); }
+	/** Key of the member at index, in key order */
+	QString keyAt(const int index) const;
+	/** Value of the member at index, in key order */
+	QJsonSnapshotValue valueAt(const int index) const;
+	/** Deep copy as a QJsonObject */
+	QJsonObject toJsonObject() const;
+
+private:
+	template<typename Key>
+	QJsonSnapshotValue find(const Key& key) const;
+
+private:
+	const char* _base = nullptr;
+	quint32 _size = 0;
+	quint32 _offset = 0;
+	quint32 _count = 0;
+};
+
+/**
+ * Snapshot of a json document laid out to be mapped and read in place, without any parse step.
+ * Opening a snapshot only map the file and check its header, values are decoded when accessed.
+ *
+ * Layout, integers are little endian and offsets are from the start of the file:
+ * * Header : "QSMS", version (4 bytes), offset of the root object (4 bytes), reserved (4 bytes)
+ * * String : length in UTF-16 code units (4 bytes), then the UTF-16 code units. 4 bytes aligned
+ * * Slot : type (4 bytes, QJsonValue::Type), reserved (4 bytes), payload (8 bytes) :
+ *   bool, double or offset of the string, array or object record
+ * * Array : count (4 bytes), reserved (4 bytes), then count slots. 8 bytes aligned
+ * * Object : count (4 bytes), reserved (4 bytes), then count members sorted by key :
+ *   offset of the key string (4 bytes), type (4 bytes), payload (8 bytes). 8 bytes aligned
+ * * Nested arrays and objects are written before their parent, a record pointing forward or to itself
+ *   is read as an empty container, so a corrupted file can't make a reader loop.
+ *
+ * \code
+ * QJsonSnapshot snapshot;
+ * if (snapshot.open(path))
+ *     setX(snapshot.root().value(QLatin1String("x")).toDouble());
+ * \endcode
+ */
+class QSUPERMACROS_API_ QJsonSnapshot
+{
+public:
+	QJsonSnapshot() = default;
+	/** Unmap the file */
+	~QJsonSnapshot();
+
+public:
+	/** Map filepath. \return false if the file can't be mapped or isn't a snapshot */
+	bool open(const QString& filepath);
+	/** Use data, kept alive by the snapshot. \return false if data isn't a snapshot */
+	bool setData(const QByteArray& data);
+	/** Unmap the file, every view become invalid */
+	void close();
+	/** True if a snapshot is open */
+	bool isOpen() const { return _base != nullptr; }
+	/** Root object, empty if no snapshot is open */
+	QJsonSnapshotObject root() const;
+
+	/** Build the snapshot of json */
+	static QByteArray fromJson(const QJsonObject& json);
+	/** True if data start with a snapshot header */
+	static bool isSnapshot(const QByteArray& data);
+
+private:
+	Q_DISABLE_COPY(QJsonSnapshot)
+
+	bool setBase(const char* base, const qint64 size);
+
+private:
+	QFile _file;
+	QByteArray _data;
+	const char* _base = nullptr;
+	quint32 _size = 0;
+	quint32 _root = 0;
+};
+
+/** Member of a snapshot object, see QJsonImportField */
+class QJsonSnapshotField
+{
+public:
+	QJsonSnapshotField(const QJsonSnapshotValue& value, const QJsonValue::Type type) : _value(value), _valid(value.type() == type) {}
+
+	/** True if the member exists with the expected type */
+	explicit operator bool() const { return _valid; }
+	/** Value of the member */
+	const QJsonSnapshotValue& value() const { return _value; }
+
+private:
+	QJsonSnapshotValue _value;
+	bool _valid;
+};
+
+/** Find key in a snapshot object, so QJSONIMPORT_* macros read snapshots like json objects */
+template<typename Key>
+inline QJsonSnapshotField qJsonImportField(const QJsonSnapshotObject& json, const Key& key, const QJsonValue::Type type)
+{
+	return QJsonSnapshotField(json.value(key), type);
+}
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
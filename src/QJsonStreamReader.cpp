@@ -0,0 +1,499 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonStreamReader.h>
+
+#include <QJsonArray>
+#include <QJsonObject>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+static int hexValue(const int c)
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return -1;
+}
+
+static bool isDelimiter(const int c)
+{
+	return c == -1 || c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+QJsonStreamReader::QJsonStreamReader(QIODevice* device) :
+	_device(device)
+{
+	_chunk.resize(ChunkSize);
+	_scratch.reserve(256);
+	_stack.reserve(16);
+}
+
+QJsonStreamReader::QJsonStreamReader(const QByteArray& data) :
+	_chunk(data),
+	_data(_chunk.constData()),
+	_size(_chunk.size())
+{
+	_scratch.reserve(256);
+	_stack.reserve(16);
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+	if (_token == Invalid || _token == EndDocument)
+		return _token;
+
+	skipWhitespace();
+	switch (_state)
+	{
+	case StateValueOrEnd:
+		if (peek() == ']')
+		{
+			get();
+			return _token = pop(ArrayContainer);
+		}
+		return _token = parseValue();
+	case StateValue:
+		return _token = parseValue();
+	case StateNameOrEnd:
+		if (peek() == '}')
+		{
+			get();
+			return _token = pop(ObjectContainer);
+		}
+		return _token = parseName();
+	case StateName:
+		return _token = parseName();
+	case StateCommaOrEnd:
+	{
+		const Container top = _stack.last();
+		const int c = get();
+		if (c == ',')
+		{
+			skipWhitespace();
+			return _token = (top == ObjectContainer ? parseName() : parseValue());
+		}
+		if (c == (top == ObjectContainer ? '}' : ']'))
+			return _token = pop(top);
+		return _token = setError("Expected ',' or end of container");
+	}
+	case StateDocumentEnd:
+		if (peek() == -1)
+			return _token = EndDocument;
+		return _token = setError("Unexpected data after the end of the document");
+	}
+	return _token = setError("Invalid reader state");
+}
+
+QJsonValue QJsonStreamReader::readValue()
+{
+	if (_token == Name)
+		readNext();
+
+	switch (_token)
+	{
+	case String:
+		return QJsonValue(_string);
+	case Number:
+		return QJsonValue(_number);
+	case Bool:
+		return QJsonValue(_bool);
+	case Null:
+		return QJsonValue(QJsonValue::Null);
+	case StartObject:
+	{
+		QJsonObject object;
+		while (readNext() == Name)
+		{
+			const QString key = _name;
+			const QJsonValue value = readValue();
+			if (value.isUndefined())
+				return value;
+			object.insert(key, value);
+		}
+		return _token == EndObject ? QJsonValue(object) : QJsonValue(QJsonValue::Undefined);
+	}
+	case StartArray:
+	{
+		QJsonArray array;
+		while (readNext() != EndArray)
+		{
+			const QJsonValue value = readValue();
+			if (value.isUndefined())
+				return value;
+			array.append(value);
+		}
+		return QJsonValue(array);
+	}
+	default:
+		return QJsonValue(QJsonValue::Undefined);
+	}
+}
+
+bool QJsonStreamReader::skipValue()
+{
+	switch (_token)
+	{
+	case Name:
+		if (!skipRawValue())
+			return false;
+		_token = valueDone(NoToken);
+		return true;
+	case StartObject:
+	case StartArray:
+		// Opening bracket is already consumed, and the container already pushed
+		if (!skipContainer(_stack.last()))
+			return false;
+		_token = pop(_stack.last());
+		return true;
+	case Invalid:
+		return false;
+	default:
+		return true;
+	}
+}
+
+bool QJsonStreamReader::fill()
+{
+	if (!_device)
+		return false;
+
+	_offset += _size;
+	_pos = 0;
+	_data = _chunk.constData();
+
+	qint64 read = _device->read(_chunk.data(), ChunkSize);
+	while (read == 0 && _device->isSequential() && _device->waitForReadyRead(-1))
+		read = _device->read(_chunk.data(), ChunkSize);
+
+	_size = read > 0 ? read : 0;
+	return _size > 0;
+}
+
+void QJsonStreamReader::skipWhitespace()
+{
+	for (;;)
+	{
+		const int c = peek();
+		if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+			return;
+		++_pos;
+	}
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::parseValue()
+{
+	switch (peek())
+	{
+	case '{':
+		get();
+		return push(ObjectContainer);
+	case '[':
+		get();
+		return push(ArrayContainer);
+	case '"':
+		get();
+		return parseString(_string) ? valueDone(String) : Invalid;
+	case 't':
+		_bool = true;
+		return parseLiteral("true", Bool);
+	case 'f':
+		_bool = false;
+		return parseLiteral("false", Bool);
+	case 'n':
+		return parseLiteral("null", Null);
+	case -1:
+		return setError("Unexpected end of document");
+	default:
+		return parseNumber();
+	}
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::parseName()
+{
+	if (get() != '"')
+		return setError("Expected member name");
+	if (!parseString(_name))
+		return Invalid;
+	skipWhitespace();
+	if (get() != ':')
+		return setError("Expected ':' after member name");
+	_state = StateValue;
+	return Name;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::parseNumber()
+{
+	_scratch.resize(0);
+	bool integer = true;
+
+	const auto appendDigits = [this]() -> bool
+	{
+		int count = 0;
+		for (int c = peek(); c >= '0' && c <= '9'; c = peek())
+		{
+			_scratch.append(char(get()));
+			++count;
+		}
+		return count > 0;
+	};
+
+	if (peek() == '-')
+		_scratch.append(char(get()));
+	if (!appendDigits())
+		return setError("Invalid number");
+	// Only a lone 0 may start with 0
+	const int sign = int(_scratch.startsWith('-'));
+	if (_scratch.size() - sign > 1 && _scratch.at(sign) == '0')
+		return setError("Invalid number, leading zero");
+	if (peek() == '.')
+	{
+		integer = false;
+		_scratch.append(char(get()));
+		if (!appendDigits())
+			return setError("Invalid number");
+	}
+	if (peek() == 'e' || peek() == 'E')
+	{
+		integer = false;
+		_scratch.append(char(get()));
+		if (peek() == '+' || peek() == '-')
+			_scratch.append(char(get()));
+		if (!appendDigits())
+			return setError("Invalid number");
+	}
+	if (!isDelimiter(peek()))
+		return setError("Invalid number");
+
+	// An integer that fit in a qint64 is rounded once when converted, same result as a full parse. The sign is applied on the double to keep -0
+	const bool negative = _scratch.startsWith('-');
+	if (integer && _scratch.size() - int(negative) <= 18)
+	{
+		const char* digits = _scratch.constData() + int(negative);
+		qint64 value = 0;
+		for (; *digits; ++digits)
+			value = value * 10 + (*digits - '0');
+		_number = negative ? -double(value) : double(value);
+	}
+	else
+	{
+		bool ok = false;
+		_number = _scratch.toDouble(&ok);
+		if (!ok)
+			return setError("Invalid number");
+	}
+	return valueDone(Number);
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::parseLiteral(const char* literal, const TokenType token)
+{
+	for (; *literal; ++literal)
+	{
+		if (get() != *literal)
+			return setError("Invalid literal");
+	}
+	if (!isDelimiter(peek()))
+		return setError("Invalid literal");
+	return valueDone(token);
+}
+
+bool QJsonStreamReader::parseString(QString& out)
+{
+	out.clear();
+	_scratch.resize(0);
+
+	for (;;)
+	{
+		int c = get();
+		if (c == '"')
+			break;
+		if (c == -1)
+		{
+			setError("Unterminated string");
+			return false;
+		}
+		if (c < 0x20)
+		{
+			setError("Control character in string");
+			return false;
+		}
+		if (c != '\\')
+		{
+			_scratch.append(char(c));
+			continue;
+		}
+
+		c = get();
+		switch (c)
+		{
+		case '"':
+		case '\\':
+		case '/':
+			_scratch.append(char(c));
+			break;
+		case 'b': _scratch.append('\b'); break;
+		case 'f': _scratch.append('\f'); break;
+		case 'n': _scratch.append('\n'); break;
+		case 'r': _scratch.append('\r'); break;
+		case 't': _scratch.append('\t'); break;
+		case 'u':
+		{
+			ushort code = 0;
+			for (int i = 0; i < 4; ++i)
+			{
+				const int digit = hexValue(get());
+				if (digit < 0)
+				{
+					setError("Invalid unicode escape sequence");
+					return false;
+				}
+				code = ushort(code << 4 | digit);
+			}
+			// UTF-16 units are appended as is, so surrogate pairs are kept together
+			out += QString::fromUtf8(_scratch);
+			_scratch.resize(0);
+			out += QChar(code);
+			break;
+		}
+		default:
+			setError("Invalid escape sequence");
+			return false;
+		}
+	}
+
+	if (out.isEmpty())
+		out = QString::fromUtf8(_scratch);
+	else
+		out += QString::fromUtf8(_scratch);
+	return true;
+}
+
+bool QJsonStreamReader::skipString()
+{
+	for (;;)
+	{
+		switch (get())
+		{
+		case '"':
+			return true;
+		case '\\':
+			get();
+			break;
+		case -1:
+			setError("Unterminated string");
+			return false;
+		default:
+			break;
+		}
+	}
+}
+
+bool QJsonStreamReader::skipContainer(const Container container)
+{
+	// Containers opened while skipping, each closing bracket must match the last one
+	QByteArray open;
+	open.append(char(container));
+	while (!open.isEmpty())
+	{
+		const int c = get();
+		switch (c)
+		{
+		case '{':
+		case '[':
+			if (_stack.size() + open.size() >= MaxDepth)
+			{
+				setError("Maximum nesting depth reached");
+				return false;
+			}
+			open.append(char(c));
+			break;
+		case '}':
+		case ']':
+			if (open.at(open.size() - 1) != (c == '}' ? ObjectContainer : ArrayContainer))
+			{
+				setError("Mismatched end of container");
+				return false;
+			}
+			open.chop(1);
+			break;
+		case '"':
+			if (!skipString())
+				return false;
+			break;
+		case -1:
+			setError("Unexpected end of document");
+			return false;
+		default:
+			break;
+		}
+	}
+	return true;
+}
+
+bool QJsonStreamReader::skipRawValue()
+{
+	skipWhitespace();
+	int c = peek();
+	if (c == '"')
+	{
+		get();
+		return skipString();
+	}
+	if (c == '{' || c == '[')
+	{
+		get();
+		return skipContainer(Container(c));
+	}
+	if (isDelimiter(c))
+	{
+		setError("Expected value");
+		return false;
+	}
+	while (!isDelimiter(c))
+	{
+		get();
+		c = peek();
+	}
+	return true;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::push(const Container container)
+{
+	if (_stack.size() >= MaxDepth)
+		return setError("Maximum nesting depth reached");
+	_stack.append(container);
+	_state = container == ObjectContainer ? StateNameOrEnd : StateValueOrEnd;
+	return container == ObjectContainer ? StartObject : StartArray;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::pop(const Container container)
+{
+	_stack.removeLast();
+	return valueDone(container == ObjectContainer ? EndObject : EndArray);
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::valueDone(const TokenType token)
+{
+	_state = _stack.isEmpty() ? StateDocumentEnd : StateCommaOrEnd;
+	return token;
+}
+
+QJsonStreamReader::TokenType QJsonStreamReader::setError(const char* error)
+{
+	if (_token != Invalid)
+		_error = QStringLiteral("%1 at offset %2").arg(QLatin1String(error)).arg(_offset + _pos);
+	_token = Invalid;
+	return Invalid;
+}
@@ -0,0 +1,178 @@
+/**
+ * \file QJsonStreamReader.h
+ * \brief Incremental json tokenizer
+ */
+#ifndef __QJSON_STREAM_READER_HPP__
+#define __QJSON_STREAM_READER_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+
+// Qt Header
+#include <QByteArray>
+#include <QIODevice>
+#include <QJsonValue>
+#include <QString>
+#include <QVector>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Pull tokenizer that read a json document from a QIODevice chunk by chunk.
+ * No QJsonDocument is ever built, memory is bounded by the nesting depth
+ * and the size of the biggest scalar.
+ *
+ * \code
+ * QJsonStreamReader reader(&file);
+ * if (reader.readNext() == QJsonStreamReader::StartObject)
+ * {
+ *     while (reader.readNext() == QJsonStreamReader::Name)
+ *     {
+ *         if (reader.name() == QLatin1String("x"))
+ *             setX(reader.readValue().toInt());
+ *         else
+ *             reader.skipValue();
+ *     }
+ * }
+ * \endcode
+ */
+class QSUPERMACROS_API_ QJsonStreamReader
+{
+public:
+	/** Token returned by readNext() */
+	enum TokenType
+	{
+		NoToken,
+		Invalid,
+		StartObject,
+		EndObject,
+		StartArray,
+		EndArray,
+		Name,
+		String,
+		Number,
+		Bool,
+		Null,
+		EndDocument
+	};
+
+	/** Read the document from device. The device must be open */
+	explicit QJsonStreamReader(QIODevice* device);
+	/** Read the document from data. Raw data (ie mapped file) must outlive the reader */
+	explicit QJsonStreamReader(const QByteArray& data);
+
+public:
+	/** Read the next token. Return Invalid and stop on error, EndDocument at the end of the root value */
+	TokenType readNext();
+	/** Last token returned by readNext() */
+	TokenType tokenType() const { return _token; }
+	/** True when the document have been fully read or an error occured */
+	bool atEnd() const { return _token == EndDocument || _token == Invalid; }
+	/** True if a syntax or device error occured */
+	bool hasError() const { return _token == Invalid; }
+	/** Description of the error, with the byte offset where it occured */
+	QString errorString() const { return _error; }
+	/** Number of containers currently open */
+	int depth() const { return _stack.size(); }
+
+	/** Member name of the current Name token */
+	const QString& name() const { return _name; }
+	/** Value of the current String token */
+	const QString& stringValue() const { return _string; }
+	/** Value of the current Number token */
+	double numberValue() const { return _number; }
+	/** Value of the current Bool token */
+	bool boolValue() const { return _bool; }
+
+	/**
+	 * Build the current value.
+	 * * On a Name token, the member value is read.
+	 * * On StartObject or StartArray, the whole container is read up to its end token.
+	 * * On a scalar token the scalar is returned.
+	 * \return Undefined on error
+	 */
+	QJsonValue readValue();
+	/**
+	 * Same as readValue() but discard the value without decoding it.
+	 * Strings and numbers inside skipped containers are never converted, only the brackets are checked.
+	 * \return false on error
+	 */
+	bool skipValue();
+
+private:
+	Q_DISABLE_COPY(QJsonStreamReader)
+
+	enum State
+	{
+		StateValue,
+		StateValueOrEnd,
+		StateName,
+		StateNameOrEnd,
+		StateCommaOrEnd,
+		StateDocumentEnd
+	};
+	enum Container : char
+	{
+		ObjectContainer = '{',
+		ArrayContainer = '['
+	};
+
+	static const int ChunkSize = 64 * 1024;
+	static const int MaxDepth = 1024;
+
+	int peek() { return (_pos < _size || fill()) ? quint8(_data[_pos]) : -1; }
+	int get() { return (_pos < _size || fill()) ? quint8(_data[_pos++]) : -1; }
+	bool fill();
+	void skipWhitespace();
+
+	TokenType parseValue();
+	TokenType parseName();
+	TokenType parseNumber();
+	TokenType parseLiteral(const char* literal, TokenType token);
+	bool parseString(QString& out);
+	bool skipString();
+	bool skipContainer(Container container);
+	bool skipRawValue();
+
+	TokenType push(Container container);
+	TokenType pop(Container container);
+	TokenType valueDone(TokenType token);
+	TokenType setError(const char* error);
+
+private:
+	QIODevice* _device = nullptr;
+	QByteArray _chunk;
+	const char* _data = nullptr;
+	qint64 _size = 0;
+	qint64 _pos = 0;
+	qint64 _offset = 0;
+
+	QVector<Container> _stack;
+	State _state = StateValue;
+	TokenType _token = NoToken;
+	QString _error;
+
+	QByteArray _scratch;
+	QString _name;
+	QString _string;
+	double _number = 0;
+	bool _bool = false;
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
@@ -0,0 +1,355 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QJsonStreamWriter.h>
+
+#include <QLocale>
+#include <QtMath>
+
+#include <cmath>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Indentation of QJsonDocument::Indented */
+static const int IndentSize = 4;
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+QJsonStreamWriter::QJsonStreamWriter(QIODevice* device, const QJsonDocument::JsonFormat format) :
+	_device(device),
+	_indented(format == QJsonDocument::Indented)
+{
+	// Reserved capacity is kept when the buffer is cleared by flush()
+	_buffer.reserve(ChunkSize + 256);
+	_stack.reserve(16);
+}
+
+QJsonStreamWriter::~QJsonStreamWriter()
+{
+	flush();
+}
+
+void QJsonStreamWriter::writeStartObject()
+{
+	writeStart(true);
+}
+
+void QJsonStreamWriter::writeEndObject()
+{
+	writeEnd(true);
+}
+
+void QJsonStreamWriter::writeStartArray()
+{
+	writeStart(false);
+}
+
+void QJsonStreamWriter::writeEndArray()
+{
+	writeEnd(false);
+}
+
+void QJsonStreamWriter::writeName(const QString& name)
+{
+	Q_ASSERT(!_stack.isEmpty() && _stack.last().object && !_afterName);
+	beginValue();
+	appendString(name.constData(), name.size());
+	_buffer.append(_indented ? ": " : ":");
+	_afterName = true;
+}
+
+void QJsonStreamWriter::writeName(const QLatin1String& name)
+{
+	Q_ASSERT(!_stack.isEmpty() && _stack.last().object && !_afterName);
+	beginValue();
+	appendString(name.data(), name.size());
+	_buffer.append(_indented ? ": " : ":");
+	_afterName = true;
+}
+
+void QJsonStreamWriter::writeNull()
+{
+	beginValue();
+	_buffer.append("null");
+	endValue();
+}
+
+void QJsonStreamWriter::writeValue(const bool value)
+{
+	beginValue();
+	_buffer.append(value ? "true" : "false");
+	endValue();
+}
+
+void QJsonStreamWriter::writeValue(const double value)
+{
+	// Json have no representation for nan and infinity, QJsonDocument write null too
+	if (!qIsFinite(value))
+	{
+		writeNull();
+		return;
+	}
+	// Same as QJsonDocument, integral values are written without exponent
+	if (value == std::floor(value) && std::fabs(value) < 9007199254740992.0)
+	{
+		writeInteger(qint64(value));
+		return;
+	}
+	beginValue();
+	_buffer.append(QByteArray::number(value, 'g', QLocale::FloatingPointShortest));
+	endValue();
+}
+
+void QJsonStreamWriter::writeValue(const QString& value)
+{
+	beginValue();
+	appendString(value.constData(), value.size());
+	endValue();
+}
+
+void QJsonStreamWriter::writeValue(const QLatin1String& value)
+{
+	beginValue();
+	appendString(value.data(), value.size());
+	endValue();
+}
+
+void QJsonStreamWriter::writeValue(const QJsonValue& value)
+{
+	switch (value.type())
+	{
+	case QJsonValue::Bool:
+		writeValue(value.toBool());
+		break;
+	case QJsonValue::Double:
+		writeValue(value.toDouble());
+		break;
+	case QJsonValue::String:
+		writeValue(value.toString());
+		break;
+	case QJsonValue::Array:
+		writeValue(value.toArray());
+		break;
+	case QJsonValue::Object:
+		writeValue(value.toObject());
+		break;
+	default:
+		writeNull();
+		break;
+	}
+}
+
+void QJsonStreamWriter::writeValue(const QJsonObject& value)
+{
+	writeStartObject();
+	for (auto it = value.constBegin(); it != value.constEnd(); ++it)
+	{
+		writeName(it.key());
+		writeValue(it.value());
+	}
+	writeEndObject();
+}
+
+void QJsonStreamWriter::writeValue(const QJsonArray& value)
+{
+	writeStartArray();
+	for (const QJsonValue& element : value)
+		writeValue(element);
+	writeEndArray();
+}
+
+void QJsonStreamWriter::writeValueAsString(const qint64 value)
+{
+	beginValue();
+	_buffer.append('"');
+	if (value < 0)
+	{
+		_buffer.append('-');
+		appendUnsigned(0 - quint64(value));
+	}
+	else
+		appendUnsigned(quint64(value));
+	_buffer.append('"');
+	endValue();
+}
+
+void QJsonStreamWriter::writeValueAsString(const quint64 value)
+{
+	beginValue();
+	_buffer.append('"');
+	appendUnsigned(value);
+	_buffer.append('"');
+	endValue();
+}
+
+bool QJsonStreamWriter::flush()
+{
+	if (!_buffer.isEmpty())
+	{
+		if (!_device || _device->write(_buffer.constData(), _buffer.size()) != _buffer.size())
+			_error = true;
+		_buffer.resize(0);
+	}
+	return !_error;
+}
+
+void QJsonStreamWriter::beginValue()
+{
+	if (_afterName)
+	{
+		_afterName = false;
+		return;
+	}
+	if (_stack.isEmpty())
+		return;
+
+	Level& level = _stack.last();
+	if (!level.empty)
+		_buffer.append(',');
+	level.empty = false;
+	writeNewLine();
+}
+
+void QJsonStreamWriter::endValue()
+{
+	if (_stack.isEmpty() && _indented)
+		_buffer.append('\n');
+	if (_buffer.size() >= ChunkSize)
+		flush();
+}
+
+void QJsonStreamWriter::writeStart(const bool object)
+{
+	beginValue();
+	_buffer.append(object ? '{' : '[');
+	_stack.append({ object, true });
+}
+
+void QJsonStreamWriter::writeEnd(const bool object)
+{
+	Q_ASSERT(!_stack.isEmpty() && _stack.last().object == object && !_afterName);
+	const bool empty = _stack.last().empty;
+	_stack.removeLast();
+	if (!empty)
+		writeNewLine();
+	_buffer.append(object ? '}' : ']');
+	endValue();
+}
+
+void QJsonStreamWriter::writeInteger(const qint64 value)
+{
+	beginValue();
+	if (value < 0)
+	{
+		_buffer.append('-');
+		// Unsigned negation is well defined for the minimum value too
+		appendUnsigned(0 - quint64(value));
+	}
+	else
+		appendUnsigned(quint64(value));
+	endValue();
+}
+
+void QJsonStreamWriter::writeUnsigned(const quint64 value)
+{
+	beginValue();
+	appendUnsigned(value);
+	endValue();
+}
+
+void QJsonStreamWriter::writeNewLine()
+{
+	if (!_indented)
+		return;
+	_buffer.append('\n');
+	_buffer.append(_stack.size() * IndentSize, ' ');
+}
+
+void QJsonStreamWriter::appendUnsigned(quint64 value)
+{
+	char digits[20];
+	int count = 0;
+	do
+	{
+		digits[count++] = char('0' + value % 10);
+		value /= 10;
+	} while (value);
+
+	while (count)
+		_buffer.append(digits[--count]);
+}
+
+void QJsonStreamWriter::appendString(const QChar* chars, const int size)
+{
+	_buffer.append('"');
+	for (int i = 0; i < size; ++i)
+	{
+		uint code = chars[i].unicode();
+		if (QChar::isHighSurrogate(code) && i + 1 < size && chars[i + 1].isLowSurrogate())
+			code = QChar::surrogateToUcs4(ushort(code), chars[++i].unicode());
+		appendEscaped(code);
+	}
+	_buffer.append('"');
+}
+
+void QJsonStreamWriter::appendString(const char* latin1, const int size)
+{
+	_buffer.append('"');
+	for (int i = 0; i < size; ++i)
+		appendEscaped(uchar(latin1[i]));
+	_buffer.append('"');
+}
+
+/** Append code point as utf-8, escaped if needed */
+void QJsonStreamWriter::appendEscaped(const uint code)
+{
+	if (code < 0x80)
+	{
+		switch (code)
+		{
+		case '"': _buffer.append("\\\""); return;
+		case '\\': _buffer.append("\\\\"); return;
+		case '\b': _buffer.append("\\b"); return;
+		case '\f': _buffer.append("\\f"); return;
+		case '\n': _buffer.append("\\n"); return;
+		case '\r': _buffer.append("\\r"); return;
+		case '\t': _buffer.append("\\t"); return;
+		default:
+			break;
+		}
+		if (code < 0x20)
+		{
+			static const char hex[] = "0123456789abcdef";
+			_buffer.append("\\u00");
+			_buffer.append(hex[code >> 4]);
+			_buffer.append(hex[code & 0xf]);
+		}
+		else
+			_buffer.append(char(code));
+	}
+	else if (code < 0x800)
+	{
+		_buffer.append(char(0xc0 | (code >> 6)));
+		_buffer.append(char(0x80 | (code & 0x3f)));
+	}
+	else if (code < 0x10000)
+	{
+		_buffer.append(char(0xe0 | (code >> 12)));
+		_buffer.append(char(0x80 | ((code >> 6) & 0x3f)));
+		_buffer.append(char(0x80 | (code & 0x3f)));
+	}
+	else
+	{
+		_buffer.append(char(0xf0 | (code >> 18)));
+		_buffer.append(char(0x80 | ((code >> 12) & 0x3f)));
+		_buffer.append(char(0x80 | ((code >> 6) & 0x3f)));
+		_buffer.append(char(0x80 | (code & 0x3f)));
+	}
+}
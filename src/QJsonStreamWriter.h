@@ -0,0 +1,143 @@
+/**
+ * \file QJsonStreamWriter.h
+ * \brief Incremental json writer
+ */
+#ifndef __QJSON_STREAM_WRITER_HPP__
+#define __QJSON_STREAM_WRITER_HPP__
+
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+// C Header
+
+// C++ Header
+#include <type_traits>
+
+// Qt Header
+#include <QByteArray>
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include <QVector>
+
+// Dependencies Header
+
+// Application Header
+#include <QSuperMacros.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+// ─────────────────────────────────────────────────────────────
+//					CLASS
+// ─────────────────────────────────────────────────────────────
+
+/**
+ * Push writer that emit a json document token by token to a QIODevice.
+ * No QJsonObject is ever built, memory is bounded by the nesting depth and an output buffer.
+ * Floating point numbers use the shortest representation that round trip.
+ *
+ * \code
+ * QJsonStreamWriter writer(&file);
+ * writer.writeStartObject();
+ * writer.writeMember(QLatin1String("x"), x());
+ * writer.writeName(QLatin1String("children"));
+ * writer.writeStartArray();
+ * for (const auto& child : children())
+ *     child->jsonStreamWrite(writer);
+ * writer.writeEndArray();
+ * writer.writeEndObject();
+ * \endcode
+ */
+class QSUPERMACROS_API_ QJsonStreamWriter
+{
+public:
+	/**
+	 * Write the document to device. The device must be open.
+	 * Output is json equivalent to QJsonDocument::toJson(format), laid out the same way, but not byte identical :
+	 * empty containers are always written `{}` and `[]`, and 64 bits integers are written exactly instead of going through a double.
+	 */
+	explicit QJsonStreamWriter(QIODevice* device, const QJsonDocument::JsonFormat format = QJsonDocument::Indented);
+	/** Flush the remaining buffered data */
+	~QJsonStreamWriter();
+
+public:
+	void writeStartObject();
+	void writeEndObject();
+	void writeStartArray();
+	void writeEndArray();
+
+	/** Write the name of the next object member */
+	void writeName(const QString& name);
+	/** Write the name of the next object member, without building a QString */
+	void writeName(const QLatin1String& name);
+
+	void writeNull();
+	void writeValue(const bool value);
+	void writeValue(const double value);
+	void writeValue(const float value) { writeValue(double(value)); }
+	void writeValue(const QString& value);
+	void writeValue(const QLatin1String& value);
+	void writeValue(const char* value) { writeValue(QLatin1String(value)); }
+	/** Write a whole value, recursively for objects and arrays */
+	void writeValue(const QJsonValue& value);
+	void writeValue(const QJsonObject& value);
+	void writeValue(const QJsonArray& value);
+	/** Integers are written with all their digits, even above 2^53 */
+	template<typename T>
+	typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type writeValue(const T value) { writeInteger(qint64(value)); }
+	template<typename T>
+	typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type writeValue(const T value) { writeUnsigned(quint64(value)); }
+
+	/** Write value as a json string, like QJSONEXPORT_INT64, without building a QString */
+	void writeValueAsString(const qint64 value);
+	/** Write value as a json string, like QJSONEXPORT_UINT64, without building a QString */
+	void writeValueAsString(const quint64 value);
+
+	/** Write an object member */
+	template<typename Name, typename T>
+	void writeMember(const Name& name, const T& value) { writeName(name); writeValue(value); }
+
+	/** Write the buffered data to the device. \return false if any write to the device failed */
+	bool flush();
+	/** True if a write to the device failed */
+	bool hasError() const { return _error; }
+
+private:
+	Q_DISABLE_COPY(QJsonStreamWriter)
+
+	struct Level
+	{
+		bool object;
+		bool empty;
+	};
+
+	static const int ChunkSize = 64 * 1024;
+
+	void beginValue();
+	void endValue();
+	void writeStart(const bool object);
+	void writeEnd(const bool object);
+	void writeInteger(const qint64 value);
+	void writeUnsigned(const quint64 value);
+	void writeNewLine();
+	void appendUnsigned(quint64 value);
+	void appendString(const QChar* chars, const int size);
+	void appendString(const char* latin1, const int size);
+	void appendEscaped(const uint code);
+
+private:
+	QIODevice* _device = nullptr;
+	QByteArray _buffer;
+	QVector<Level> _stack;
+	bool _indented = true;
+	bool _afterName = false;
+	bool _error = false;
+};
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif
@@ -120,11 +120,13 @@ QSUPERMACROS_NAMESPACE_START
  * It generates for this goal :
  *  \code
  *      // QSM_AUTO_SETTER_DECL(type, name, Name)
- *      bool setName(CheapestType<type>::type_def name)
+ *      bool setName(type name)
  *  \endcode
+ *
+ * \note Breaking change : the value used to be taken by `const type &` for types that aren't cheap to copy.
  */
 #define QSM_AUTO_SETTER_DECL(type, name, Name) \
-    bool QSM_MAKE_SETTER_NAME(name, Name) (QSUPERMACROS_NAMESPACE::CheapestType<type>::type_def name)
+    bool QSM_MAKE_SETTER_NAME(name, Name) (type name)
 
 /** Generate virtual Setter in the form `set<Name>`
  * \ingroup QSM_AUTO_HELPER
@@ -136,8 +138,10 @@ QSUPERMACROS_NAMESPACE_START
  * It generates for this goal :
  *  \code
  *      // QSM_AUTO_SETTER_DECL(type, name, Name)
- *      virtual bool setName(CheapestType<type>::type_def name) = 0;
+ *      virtual bool setName(type name) = 0;
  *  \endcode
+ *
+ * \note Breaking change : overrides must take `type` by value, ie `bool setName(QString name) override`, not `const QString &`.
  */
 #define QSM_AUTO_SETTER_VIRTUAL(type, name, Name) \
     virtual QSM_AUTO_SETTER_DECL(type, name, Name) = 0;
@@ -152,11 +156,11 @@ QSUPERMACROS_NAMESPACE_START
  * It generates for this goal :
  *  \code
  *      // Default Naming Convention
- *      bool setName(CheapestType<type>::type_def name)
+ *      bool setName(type name)
  *      {
  *          if(_name != name)
  *          {
- *              _name = name;
+ *              _name = std::move(name);
  *              Q_EMIT nameChanged();
  *              return true;
  *          }
@@ -164,13 +168,58 @@ QSUPERMACROS_NAMESPACE_START
  *              return false;
  *      }
  *  \endcode
+ *
+ * The value is a sink: temporaries are moved into the attribute, lvalues are copied once, even if equal to the current value.
+ * Types that CheapestType pass by value keep the same signature.
+ * \note Breaking change : the value used to be taken by `const type &` for types that aren't cheap to copy.
+ * When the class inherit QQmlDirtyTracker, a change also mark the property dirty.
  */
 #define QSM_AUTO_SETTER(type, name, Name) \
-    bool QSM_MAKE_SETTER_NAME(name, Name) (QSUPERMACROS_NAMESPACE::CheapestType<type>::type_def name) \
+    bool QSM_MAKE_SETTER_NAME(name, Name) (type name) \
+    { \
+        if (QSM_MAKE_ATTRIBUTE_NAME(name, Name) != (name)) { \
+            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = std::move(name); \
+            QSM_MARK_DIRTY(name); \
+            QSM_EMIT_CHANGED(name, Name); \
+            return true; \
+        } \
+        else \
+            return false; \
+    }
+
+/** Generate a Setter in the form `set<Name>` that store the value now and emit its signal at the next event loop iteration
+ * \ingroup QSM_AUTO_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ *
+ * It generates for this goal :
+ *  \code
+ *      // Default Naming Convention
+ *      bool setName(type name)
+ *      {
+ *          if(_name != name)
+ *          {
+ *              _name = name;
+ *              QQmlDeferredNotify::schedule(this, nameIndex, [this]() { Q_EMIT nameChanged(_name); });
+ *              return true;
+ *          }
+ *          else
+ *              return false;
+ *      }
+ *  \endcode
+ *
+ * However many times the value change before the event loop run, `nameChanged` is emitted once with the newest value.
+ * The setter must be called from the thread of the object, since the queued signal read `_name` when it is emitted.
+ */
+#define QSM_AUTO_DEFERRED_SETTER(type, name, Name) \
+    bool QSM_MAKE_SETTER_NAME(name, Name) (type name) \
     { \
         if (QSM_MAKE_ATTRIBUTE_NAME(name, Name) != (name)) { \
-            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = name; \
-            Q_EMIT QSM_MAKE_SIGNAL_NAME(name, Name) (name); \
+            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = std::move(name); \
+            QSM_MARK_DIRTY(name); \
+            QSM_EMIT_CHANGED_DEFERRED(name, Name); \
             return true; \
         } \
         else \
@@ -201,7 +250,8 @@ QSUPERMACROS_NAMESPACE_START
 #define QSM_AUTO_SETTER_BODY(type, name, Name) \
     { \
         if (QSM_MAKE_ATTRIBUTE_NAME(name, Name) != name) { \
-            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = name; \
+            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = std::move(name); \
+            QSM_MARK_DIRTY(name); \
             return true; \
         } \
         else \
@@ -233,8 +283,9 @@ QSUPERMACROS_NAMESPACE_START
 #define QSM_AUTO_SETTER_BODY_WSIGNAL(type, name, Name) \
     { \
         if (QSM_MAKE_ATTRIBUTE_NAME(name, Name) != (name)) { \
-            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = name; \
-            Q_EMIT QSM_MAKE_SIGNAL_NAME(name, Name) (name); \
+            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = std::move(name); \
+            QSM_MARK_DIRTY(name); \
+            QSM_EMIT_CHANGED(name, Name); \
             return true; \
         } \
         else \
@@ -326,7 +377,7 @@ QSUPERMACROS_NAMESPACE_START
  *      // QSM_WRITABLE_AUTO_VIRTUAL(type, name, Name)
  *      public:
  *          virtual CheapestType<type>::type_def getName() const = 0;
- *          virtual bool setName(CheapestType<type>::type_def name) = 0;
+ *          virtual bool setName(type name) = 0;
  *          virtual bool resetName() = 0;
  *      private:
  *  \endcode
@@ -367,7 +418,7 @@ QSUPERMACROS_NAMESPACE_START
  *             type _name = def;
  *      public:
  *          CheapestType<type>::type_def getName() const { return _name; }
- *          bool setName(CheapestType<type>::type_def name)
+ *          bool setName(type name)
  *          {
  *              if(_name != name)
  *              {
@@ -437,7 +488,7 @@ QSUPERMACROS_NAMESPACE_START
   *             type _name = def;
   *      public:
   *          CheapestType<type>::type_def getName() const { return _name; }
-  *          bool setName(CheapestType<type>::type_def name)
+  *          bool setName(type name)
   *          {
   *              if(_name != name)
   *                  _name = name;
@@ -487,7 +538,7 @@ QSUPERMACROS_NAMESPACE_START
    *             type _name = {};
    *      public:
    *          CheapestType<type>::type_def getName() const { return _name; }
-   *          bool setName(CheapestType<type>::type_def name)
+   *          bool setName(type name)
    *          {
    *              if(_name != name)
    *                  _name = name;
@@ -531,7 +582,7 @@ QSUPERMACROS_NAMESPACE_START
  *          type _name = {}};
  *      public:
  *          CheapestType<type>::type_def getName() const { return _name; }
- *          bool setName(CheapestType<type>::type_def name)
+ *          bool setName(type name)
  *          {
  *              if(_name != name)
  *              {
@@ -581,7 +632,7 @@ QSUPERMACROS_NAMESPACE_START
  *          type _name = def;
  *      public:
  *          CheapestType<type>::type_def getName() const { return _name; }
- *          bool setName(CheapestType<type>::type_def name)
+ *          bool setName(type name)
  *          {
  *              if(_name != name)
  *              {
@@ -640,7 +691,7 @@ QSUPERMACROS_NAMESPACE_START
  *          type _name = {};
  *      public:
  *          CheapestType<type>::type_def getName() const { return _name; }
- *          bool setName(CheapestType<type>::type_def name)
+ *          bool setName(type name)
  *          {
  *              if(_name != name)
  *              {
@@ -671,6 +722,78 @@ QSUPERMACROS_NAMESPACE_START
 #define QSM_READONLY_AUTO_PROPERTY(type, name, Name) \
         QSM_READONLY_AUTO_PROPERTY_WDEFAULT(type, name, Name, {})
 
+/** Generate a **Writable** Auto Property whose change signal is emitted at most once per event loop iteration
+ * Meant for properties written at a high rate from C++, when QML only need the newest value once per frame.
+ * The setter store the value immediately, the signal is queued in QQmlDeferredNotify and carry the newest value.
+ * The setter must be called from the thread of the object.
+ * \ingroup QSM_AUTO_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ * \param def Default value of the members. If you want to let the type choose default value just use `{}`
+ *
+ *  You can declare a property in your QObject like this
+ *  \code
+ *  // Position updated by a sensor thousands of times per second, notified once per frame
+ *  QSM_WRITABLE_DEFERRED_AUTO_PROPERTY_WDEFAULT(QPointF, position, Position, QPointF());
+ *  \endcode
+ */
+#define QSM_WRITABLE_DEFERRED_AUTO_PROPERTY_WDEFAULT(type, name, Name, def) \
+    protected: \
+        Q_PROPERTY (type name READ QSM_MAKE_GETTER_NAME(name, Name) WRITE QSM_MAKE_SETTER_NAME(name, Name) RESET QSM_MAKE_RESET_NAME(name, Name) NOTIFY QSM_MAKE_SIGNAL_NAME(name, Name)) \
+    private: \
+        QSM_AUTO_MEMBER (type, name, Name, def) \
+    public: \
+        QSM_AUTO_GETTER (type, name, Name) \
+        QSM_AUTO_DEFERRED_SETTER (type, name, Name) \
+        QSM_AUTO_RESET(type, name, Name, def) \
+    Q_SIGNALS: \
+        QSM_AUTO_NOTIFIER (type, name, Name) \
+    private:
+
+/** Generate a **Writable** Auto Property notified once per event loop iteration, default to `{}`
+ * \ingroup QSM_AUTO_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_WRITABLE_DEFERRED_AUTO_PROPERTY(type, name, Name) \
+        QSM_WRITABLE_DEFERRED_AUTO_PROPERTY_WDEFAULT(type, name, Name, {})
+
+/** Generate a **Read-Only** Auto Property whose change signal is emitted at most once per event loop iteration
+ * See QSM_WRITABLE_DEFERRED_AUTO_PROPERTY_WDEFAULT.
+ * \ingroup QSM_AUTO_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ * \param def Default value of the members. If you want to let the type choose default value just use `{}`
+ */
+#define QSM_READONLY_DEFERRED_AUTO_PROPERTY_WDEFAULT(type, name, Name, def) \
+    protected: \
+        Q_PROPERTY (type name READ QSM_MAKE_GETTER_NAME(name, Name) NOTIFY QSM_MAKE_SIGNAL_NAME(name, Name)) \
+    private: \
+        QSM_AUTO_MEMBER (type, name, Name, def) \
+    public: \
+        QSM_AUTO_GETTER (type, name, Name) \
+        QSM_AUTO_DEFERRED_SETTER (type, name, Name) \
+        QSM_AUTO_RESET (type, name, Name, def) \
+    Q_SIGNALS: \
+        QSM_AUTO_NOTIFIER (type, name, Name) \
+    private:
+
+/** Generate a **Read-Only** Auto Property notified once per event loop iteration, default to `{}`
+ * \ingroup QSM_AUTO_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_READONLY_DEFERRED_AUTO_PROPERTY(type, name, Name) \
+        QSM_READONLY_DEFERRED_AUTO_PROPERTY_WDEFAULT(type, name, Name, {})
+
 /** Generate a **Const** Auto Property
  * Auto Property uses either `T` or `T*` and is capable of adding constant-reference by
  * deciding itself which type is the cheapest (using some template trickery internally).
@@ -808,7 +931,7 @@ QSUPERMACROS_NAMESPACE_START
    *             type _name = def;
    *      public:
    *          CheapestType<type>::type_def getName() const { return _name; }
-   *          bool setName(CheapestType<type>::type_def name)
+   *          bool setName(type name)
    *          {
    *              if(_name != name)
    *              {
@@ -882,7 +1005,7 @@ QSUPERMACROS_NAMESPACE_START
    *             type _name = def;
    *      public:
    *          CheapestType<type>::type_def getName() const { return _name; }
-   *          bool setName(CheapestType<type>::type_def name)
+   *          bool setName(type name)
    *          {
    *              if(_name != name)
    *              {
@@ -0,0 +1,208 @@
+/**
+ * \file QQmlBindablePropertyHelpers.h
+ * \brief Declare Qt 6 Bindable Properties Helper
+ */
+#ifndef QQMLBINDABLEPROPERTYHELPERS_H
+#define QQMLBINDABLEPROPERTYHELPERS_H
+
+#include <QObject>
+
+#include "QQmlHelpersCommon.h"
+#include "QQmlAutoPropertyHelpers.h"
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+
+#include <QProperty>
+
+QSUPERMACROS_NAMESPACE_START
+
+ /**
+  * \defgroup QSM_BINDABLE_HELPER Bindable Properties
+  * \brief Macros to generate properties stored in a `QObjectBindableProperty`, with the getter, setter, reset and signal of Auto Properties.
+  * C++ bindings set with `QBindable` are evaluated lazily, when the value is read, without going through signals and slots.
+  * Only available with Qt 6.
+  */
+
+/** Initial value of a bindable property, so `def` can be `{}` or `nullptr` whatever the type */
+template<typename T>
+inline T qsmBindableDefault(const T& value) { return value; }
+
+// NOTE : Q_OBJECT_BINDABLE_PROPERTY paste its name argument, QSM_MAKE_ATTRIBUTE_NAME have to be expanded before
+
+#define QSM_BINDABLE_MEMBER_WDEFAULT_IMPL(Class, type, attribute, def, signal) \
+    Q_OBJECT_BINDABLE_PROPERTY_WITH_ARGS(Class, type, attribute, QSUPERMACROS_NAMESPACE::qsmBindableDefault<type>(def), signal)
+
+// NOTE : individual macros for getter, setter, bindable and member
+
+/** Generate a `QObjectBindableProperty` member in the form `_<name>`, that notify `<name>Changed`
+ * \ingroup QSM_BINDABLE_HELPER
+ * \hideinitializer
+ * \param Class Class that declare the property
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ * \param def Default value of the member
+ * \note The signal have to be declared before the member
+ */
+#define QSM_BINDABLE_MEMBER(Class, type, name, Name, def) \
+    QSM_BINDABLE_MEMBER_WDEFAULT_IMPL(Class, type, QSM_MAKE_ATTRIBUTE_NAME(name, Name), def, &Class::QSM_MAKE_SIGNAL_NAME(name, Name))
+
+/** Generate a Getter in the form `get<Name>` that read the bindable property, evaluating its binding if needed.
+ * Like Auto Properties, large types are returned by const reference to the stored value
+ * \ingroup QSM_BINDABLE_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_BINDABLE_GETTER(type, name, Name) \
+    QSUPERMACROS_NAMESPACE::CheapestType<type>::type_def QSM_MAKE_GETTER_NAME(name, Name) () const { return QSM_MAKE_ATTRIBUTE_NAME(name, Name).value(); }
+
+/** Generate a Setter in the form `set<Name>`. Like a write from QML, it remove the binding of the property
+ * \ingroup QSM_BINDABLE_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ *
+ * It generates for this goal :
+ *  \code
+ *      // Default Naming Convention
+ *      bool setName(type name)
+ *      {
+ *          const bool changed = _name.value() != name;
+ *          _name.setValue(std::move(name)); // Emit nameChanged if changed
+ *          return changed;
+ *      }
+ *  \endcode
+ *
+ * When the class inherit QQmlDirtyTracker, a change also mark the property dirty.
+ * Changes made by a binding aren't tracked.
+ */
+#define QSM_BINDABLE_SETTER(type, name, Name) \
+    bool QSM_MAKE_SETTER_NAME(name, Name) (type name) \
+    { \
+        const bool changed = QSM_MAKE_ATTRIBUTE_NAME(name, Name).value() != (name); \
+        QSM_MAKE_ATTRIBUTE_NAME(name, Name).setValue(std::move(name)); \
+        if (changed) \
+            QSM_MARK_DIRTY(name); \
+        return changed; \
+    }
+
+/** Generate the bindable accessor in the form `bindable<Name>`, used by `BINDABLE` in the `Q_PROPERTY`
+ * \ingroup QSM_BINDABLE_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ *
+ * It generates for this goal :
+ *  \code
+ *      // Default Naming Convention
+ *      QBindable<type> bindableName() { return QBindable<type>(&_name); }
+ *  \endcode
+ */
+#define QSM_BINDABLE_ACCESSOR(type, name, Name) \
+    QBindable<type> QSM_MAKE_BINDABLE_NAME(name, Name) () { return QBindable<type>(&QSM_MAKE_ATTRIBUTE_NAME(name, Name)); }
+
+// NOTE : Actual Helpers
+
+/** Generate a **Writable** Bindable Property
+ * \ingroup QSM_BINDABLE_HELPER
+ * \hideinitializer
+ * \param Class Class that declare the property, required by `Q_OBJECT_BINDABLE_PROPERTY`
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ * \param def Default value of the members. If you want to let the type choose default value just use `{}`
+ *
+ * It generates for this goal :
+ *  \code
+ *      // QSM_BINDABLE_WRITABLE_PROPERTY_WDEFAULT(Class, type, name, Name, def)
+ *      protected:
+ *          Q_PROPERTY (type name READ getName WRITE setName RESET resetName NOTIFY nameChanged BINDABLE bindableName)
+ *      Q_SIGNALS:
+ *          void nameChanged(type name);
+ *      private:
+ *          Q_OBJECT_BINDABLE_PROPERTY_WITH_ARGS(Class, type, _name, def, &Class::nameChanged)
+ *      public:
+ *          CheapestType<type>::type_def getName() const { return _name.value(); }
+ *          bool setName(type name);
+ *          bool resetName() { return setName(def); }
+ *          QBindable<type> bindableName() { return QBindable<type>(&_name); }
+ *      private:
+ *  \endcode
+ *
+ *  You can declare a property in your QObject like this
+ *  \code
+ *  // Width whose area binding is only evaluated when area is read
+ *  QSM_BINDABLE_WRITABLE_PROPERTY_WDEFAULT(MyObject, int, width, Width, 23);
+ *  QSM_BINDABLE_READONLY_PROPERTY(MyObject, int, area, Area);
+ *  ...
+ *  bindableArea().setBinding([this]() { return width() * height(); });
+ *  \endcode
+ */
+#define QSM_BINDABLE_WRITABLE_PROPERTY_WDEFAULT(Class, type, name, Name, def) \
+    protected: \
+        Q_PROPERTY (type name READ QSM_MAKE_GETTER_NAME(name, Name) WRITE QSM_MAKE_SETTER_NAME(name, Name) RESET QSM_MAKE_RESET_NAME(name, Name) NOTIFY QSM_MAKE_SIGNAL_NAME(name, Name) BINDABLE QSM_MAKE_BINDABLE_NAME(name, Name)) \
+    Q_SIGNALS: \
+        QSM_AUTO_NOTIFIER (type, name, Name) \
+    private: \
+        QSM_BINDABLE_MEMBER (Class, type, name, Name, def) \
+    public: \
+        QSM_BINDABLE_GETTER (type, name, Name) \
+        QSM_BINDABLE_SETTER (type, name, Name) \
+        QSM_AUTO_RESET (type, name, Name, def) \
+        QSM_BINDABLE_ACCESSOR (type, name, Name) \
+    private:
+
+/** Generate a **Writable** Bindable Property, default to `{}`
+ * \ingroup QSM_BINDABLE_HELPER
+ * \hideinitializer
+ * \param Class Class that declare the property, required by `Q_OBJECT_BINDABLE_PROPERTY`
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_BINDABLE_WRITABLE_PROPERTY(Class, type, name, Name) \
+        QSM_BINDABLE_WRITABLE_PROPERTY_WDEFAULT(Class, type, name, Name, {})
+
+/** Generate a **Read-Only** Bindable Property. Only C++ can set its value or its binding
+ * \ingroup QSM_BINDABLE_HELPER
+ * \hideinitializer
+ * \param Class Class that declare the property, required by `Q_OBJECT_BINDABLE_PROPERTY`
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ * \param def Default value of the members. If you want to let the type choose default value just use `{}`
+ */
+#define QSM_BINDABLE_READONLY_PROPERTY_WDEFAULT(Class, type, name, Name, def) \
+    protected: \
+        Q_PROPERTY (type name READ QSM_MAKE_GETTER_NAME(name, Name) NOTIFY QSM_MAKE_SIGNAL_NAME(name, Name) BINDABLE QSM_MAKE_BINDABLE_NAME(name, Name)) \
+    Q_SIGNALS: \
+        QSM_AUTO_NOTIFIER (type, name, Name) \
+    private: \
+        QSM_BINDABLE_MEMBER (Class, type, name, Name, def) \
+    public: \
+        QSM_BINDABLE_GETTER (type, name, Name) \
+        QSM_BINDABLE_SETTER (type, name, Name) \
+        QSM_AUTO_RESET (type, name, Name, def) \
+        QSM_BINDABLE_ACCESSOR (type, name, Name) \
+    private:
+
+/** Generate a **Read-Only** Bindable Property, default to `{}`
+ * \ingroup QSM_BINDABLE_HELPER
+ * \hideinitializer
+ * \param Class Class that declare the property, required by `Q_OBJECT_BINDABLE_PROPERTY`
+ * \param type Type of the attribute (`int`, `quint32`, `QObject*`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_BINDABLE_READONLY_PROPERTY(Class, type, name, Name) \
+        QSM_BINDABLE_READONLY_PROPERTY_WDEFAULT(Class, type, name, Name, {})
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif // QT_VERSION >= 6
+
+#endif // QQMLBINDABLEPROPERTYHELPERS_H
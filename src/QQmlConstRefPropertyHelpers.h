@@ -50,11 +50,11 @@ QSUPERMACROS_NAMESPACE_START
  * It generates for this goal :
  *  \code
  *      // Default Naming Convention
- *      bool SetName(const type& name) 
+ *      bool SetName(type name)
  *      {
  *          if(_name != name)
  *          {
- *              _name = name;
+ *              _name = std::move(name);
  *              emit NameChanged(_name);
  *          }
  *          else 
@@ -62,24 +62,30 @@ QSUPERMACROS_NAMESPACE_START
  *      }
  *
  *      // Qt Naming Convention
- *      bool setName(const type& name) 
+ *      bool setName(type name)
  *      {
  *          if(m_name != name)
  *          {
- *              m_name = name;
+ *              m_name = std::move(name);
  *              emit nameChanged(m_name);
  *          }
  *          else 
  *              return false;
  *      }
  *  \endcode
+ *
+ * The value is a sink: temporaries are moved into the attribute, lvalues are copied once, even if equal to the current value.
+ * Pass an rvalue to avoid that copy for types that aren't implicitly shared, like `std::vector`.
+ * \note Breaking change : the value used to be taken by `const type &`.
+ * When the class inherit QQmlDirtyTracker, a change also mark the property dirty.
  */
 #define QSM_CSTREF_SETTER(type, name, Name) \
-    bool QSM_MAKE_SETTER_NAME(name, Name) (const type & name) \
+    bool QSM_MAKE_SETTER_NAME(name, Name) (type name) \
     { \
         if (QSM_MAKE_ATTRIBUTE_NAME(name, Name) != name) { \
-            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = name; \
-            emit QSM_MAKE_SIGNAL_NAME(name, Name) (QSM_MAKE_ATTRIBUTE_NAME(name, Name)); \
+            QSM_MAKE_ATTRIBUTE_NAME(name, Name) = std::move(name); \
+            QSM_MARK_DIRTY(name); \
+            QSM_EMIT_CHANGED(name, Name); \
             return true; \
         } \
         else \
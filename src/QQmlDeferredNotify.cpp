@@ -0,0 +1,135 @@
+#include <QHash>
+#include <QMutex>
+#include <QPair>
+#include <QPointer>
+#include <QThread>
+#include <QVector>
+
+#include "QQmlDeferredNotify.h"
+
+QSUPERMACROS_USING_NAMESPACE
+
+/** Signal waiting for the flush, its object is tracked to skip it once destroyed */
+struct DeferredNotify
+{
+	QPointer<QObject> object;
+	std::function<void()> emitter;
+};
+
+/** Queued signals of the objects of a thread, the flusher live in that thread to be invoked in it */
+class DeferredNotifyFlusher : public QObject
+{
+public:
+	QHash<QPair<const QObject*, int>, int> positions;
+	QVector<DeferredNotify> notifies;
+	bool scheduled = false;
+};
+
+/** Flusher of each thread that queued a signal. The mutex guard the map and every queue */
+struct DeferredNotifyFlushers
+{
+	QMutex mutex;
+	QHash<QThread*, DeferredNotifyFlusher*> flushers;
+};
+
+static DeferredNotifyFlushers& deferredNotifyFlushers()
+{
+	static DeferredNotifyFlushers flushers;
+	return flushers;
+}
+
+/** Flusher of thread, created on first use. The flushers mutex must be locked */
+static DeferredNotifyFlusher* deferredNotifyFlusher(QThread* thread)
+{
+	DeferredNotifyFlushers& flushers = deferredNotifyFlushers();
+	if (DeferredNotifyFlusher* flusher = flushers.flushers.value(thread))
+		return flusher;
+
+	auto* flusher = new DeferredNotifyFlusher;
+	flusher->moveToThread(thread);
+	// Deleted by the thread once its event loop exited, the main thread one live until exit
+	QObject::connect(thread, &QThread::finished, flusher, &QObject::deleteLater);
+	QObject::connect(flusher, &QObject::destroyed, [thread, flusher]()
+	{
+		DeferredNotifyFlushers& flushers = deferredNotifyFlushers();
+		QMutexLocker lock(&flushers.mutex);
+		if (flushers.flushers.value(thread) == flusher)
+			flushers.flushers.remove(thread);
+	});
+	flushers.flushers.insert(thread, flusher);
+	return flusher;
+}
+
+/** Emit the queued signals of flusher, in its thread */
+static void flushDeferredNotify(DeferredNotifyFlusher* flusher)
+{
+	// Swap first, setters called by the slots are queued for the next iteration
+	QVector<DeferredNotify> notifies;
+	{
+		QMutexLocker lock(&deferredNotifyFlushers().mutex);
+		flusher->scheduled = false;
+		notifies.swap(flusher->notifies);
+		flusher->positions.clear();
+	}
+
+	for (const auto& notify : notifies)
+	{
+		if (notify.object)
+			notify.emitter();
+	}
+}
+
+void QQmlDeferredNotify::schedule(QObject* object, const int index, const std::function<void()>& emitter)
+{
+	QThread* thread = object->thread();
+	// Nothing would ever flush the queue of a thread that is gone
+	if (!thread || thread->isFinished())
+	{
+		emitter();
+		return;
+	}
+	Q_ASSERT_X(thread == QThread::currentThread(), "QQmlDeferredNotify::schedule", "Deferred setters must be called from the thread of their object");
+
+	DeferredNotifyFlushers& flushers = deferredNotifyFlushers();
+	QMutexLocker lock(&flushers.mutex);
+	DeferredNotifyFlusher* flusher = deferredNotifyFlusher(thread);
+
+	const auto key = qMakePair(static_cast<const QObject*>(object), index);
+	const auto it = flusher->positions.constFind(key);
+	if (it != flusher->positions.constEnd())
+	{
+		DeferredNotify& notify = flusher->notifies[it.value()];
+		// The queued emitter read the newest value, unless it belong to a destroyed object at the same address
+		if (!notify.object)
+			notify = DeferredNotify{ object, emitter };
+		return;
+	}
+
+	flusher->positions.insert(key, flusher->notifies.size());
+	flusher->notifies.append(DeferredNotify{ object, emitter });
+	if (!flusher->scheduled)
+	{
+		flusher->scheduled = true;
+		QMetaObject::invokeMethod(flusher, [flusher]() { flushDeferredNotify(flusher); }, Qt::QueuedConnection);
+	}
+}
+
+void QQmlDeferredNotify::flush()
+{
+	DeferredNotifyFlusher* flusher = nullptr;
+	{
+		DeferredNotifyFlushers& flushers = deferredNotifyFlushers();
+		QMutexLocker lock(&flushers.mutex);
+		flusher = flushers.flushers.value(QThread::currentThread());
+	}
+	if (flusher)
+		flushDeferredNotify(flusher);
+}
+
+int QQmlDeferredNotify::pendingCount()
+{
+	DeferredNotifyFlushers& flushers = deferredNotifyFlushers();
+	QMutexLocker lock(&flushers.mutex);
+	const DeferredNotifyFlusher* flusher = flushers.flushers.value(QThread::currentThread());
+	return flusher ? flusher->notifies.size() : 0;
+}
@@ -0,0 +1,58 @@
+/**
+ * \file QQmlDeferredNotify.h
+ * \brief Emit change signals once per event loop iteration
+ */
+#ifndef QQMLDEFERREDNOTIFY_H
+#define QQMLDEFERREDNOTIFY_H
+
+#include <functional>
+
+#include <QObject>
+
+#include <QSuperMacros.h>
+#include <QQmlDirtyTracker.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+/**
+ * Queue of change signals, emitted at the next iteration of the event loop of the object thread.
+ * A property changed many times before the queue is flushed emits once, with its newest value.
+ * Each thread has one queue, flushed by a queued call to a flusher object living in that thread,
+ * so deferred properties don't need a timer per object.
+ * \ingroup QSM_DIRTY_HELPER
+ *
+ * * Setters must be called from the thread of their object. The queued emitter read the attribute when it is flushed,
+ *   so a write from another thread would race with it. Use a queued invocation to set a property from another thread.
+ * * Signals are emitted in the order their properties first changed.
+ * * Signals of an object destroyed meanwhile are dropped.
+ * * A setter called by a slot during the flush is emitted at the next iteration.
+ * * An object whose thread finished emits immediately.
+ */
+class QSUPERMACROS_API_ QQmlDeferredNotify
+{
+public:
+    /** Call emitter at the next event loop iteration of the thread of object, unless the property index of object is already queued. Must be called from the thread of object */
+    static void schedule(QObject* object, const int index, const std::function<void()>& emitter);
+    /** Emit every queued signal of the current thread now */
+    static void flush();
+    /** Number of signals queued in the current thread */
+    static int pendingCount();
+};
+
+/**
+ * \def QSM_EMIT_CHANGED_DEFERRED(name, Name)
+ * \ingroup QSM_DIRTY_HELPER
+ * \hideinitializer
+ * \brief Queue the change signal of the property `name` of `this` in QQmlDeferredNotify.
+ * The signal carries the value of the attribute when it is emitted.
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_EMIT_CHANGED_DEFERRED(name, Name) \
+    QSUPERMACROS_NAMESPACE::QQmlDeferredNotify::schedule(this, \
+        []() -> int { static const int index = QSUPERMACROS_NAMESPACE::QQmlDirtyTracker::fieldIndex(#name); return index; }(), \
+        [this]() { Q_EMIT QSM_MAKE_SIGNAL_NAME(name, Name) (QSM_MAKE_ATTRIBUTE_NAME(name, Name)); })
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif // QQMLDEFERREDNOTIFY_H
@@ -0,0 +1,87 @@
+#include <QHash>
+#include <QReadWriteLock>
+#include <QVector>
+
+#include "QQmlDirtyTracker.h"
+
+QSUPERMACROS_USING_NAMESPACE
+
+/** Interned property names, an index is never reused */
+struct DirtyFieldTable
+{
+	QReadWriteLock lock;
+	QHash<QByteArray, int> indexes;
+	QVector<QByteArray> names;
+};
+
+static DirtyFieldTable& dirtyFieldTable()
+{
+	static DirtyFieldTable table;
+	return table;
+}
+
+int QQmlDirtyTracker::fieldIndex(const char* name)
+{
+	DirtyFieldTable& table = dirtyFieldTable();
+	const QByteArray key = QByteArray::fromRawData(name, int(qstrlen(name)));
+	{
+		QReadLocker lock(&table.lock);
+		const auto it = table.indexes.constFind(key);
+		if (it != table.indexes.constEnd())
+			return it.value();
+	}
+
+	QWriteLocker lock(&table.lock);
+	const auto it = table.indexes.constFind(key);
+	if (it != table.indexes.constEnd())
+		return it.value();
+
+	// Deep copy, name isn't guaranteed to outlive the table
+	const QByteArray ownedName(name);
+	const int index = table.names.size();
+	table.names.append(ownedName);
+	table.indexes.insert(ownedName, index);
+	return index;
+}
+
+QByteArray QQmlDirtyTracker::fieldName(const int index)
+{
+	DirtyFieldTable& table = dirtyFieldTable();
+	QReadLocker lock(&table.lock);
+	return table.names.value(index);
+}
+
+void QQmlDirtyTracker::markDirty(const int index)
+{
+	if (index >= _dirty.size())
+		_dirty.resize(index + 1);
+	if (!_dirty.testBit(index))
+	{
+		_dirty.setBit(index);
+		++_dirtyCount;
+	}
+}
+
+QList<QByteArray> QQmlDirtyTracker::dirtyFields() const
+{
+	QList<QByteArray> fields;
+	if (!_dirtyCount)
+		return fields;
+
+	fields.reserve(_dirtyCount);
+	for (int i = 0; i < _dirty.size(); ++i)
+	{
+		if (_dirty.testBit(i))
+			fields.append(fieldName(i));
+	}
+	return fields;
+}
+
+void QQmlDirtyTracker::clearDirty()
+{
+	if (_dirtyCount)
+	{
+		_dirty.fill(false);
+		_dirtyCount = 0;
+	}
+}
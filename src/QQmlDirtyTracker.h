@@ -0,0 +1,108 @@
+/**
+ * \file QQmlDirtyTracker.h
+ * \brief Track which properties changed since the last save
+ */
+#ifndef QQMLDIRTYTRACKER_H
+#define QQMLDIRTYTRACKER_H
+
+#include <type_traits>
+
+#include <QBitArray>
+#include <QByteArray>
+#include <QList>
+
+#include <QSuperMacros.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+/**
+ * \defgroup QSM_DIRTY_HELPER Dirty Tracking
+ * \brief Opt-in tracking of the properties that changed, maintained by the generated setters
+ */
+
+/**
+ * Mixin that keep one dirty bit per property.
+ * Inherit from it and every `QSM_AUTO_SETTER`, `QSM_VAR_SETTER` and `QSM_CSTREF_SETTER`
+ * of the class mark its property dirty when the value change.
+ * Classes that don't inherit it pay nothing.
+ * \ingroup QSM_DIRTY_HELPER
+ *
+ * \code
+ * class MyObject : public QObject, public QJsonImportExport, public QQmlDirtyTracker
+ * {
+ *     Q_OBJECT
+ *     QSM_WRITABLE_AUTO_PROPERTY(int, x, X);
+ * };
+ * object.setX(12);
+ * object.isDirty("x"); // true
+ * \endcode
+ */
+class QSUPERMACROS_API_ QQmlDirtyTracker
+{
+public:
+    /** Public virtual Destructor */
+    virtual ~QQmlDirtyTracker() = default;
+
+public:
+    /** Index of the property name, shared by every class. Thread safe, call it once per property and keep the result */
+    static int fieldIndex(const char* name);
+    /** Property name of index */
+    static QByteArray fieldName(const int index);
+
+    /** Mark the property at index as changed */
+    void markDirty(const int index);
+    /** Mark the property as changed */
+    void markDirty(const char* name) { markDirty(fieldIndex(name)); }
+    /** True if the property at index changed since the last clearDirty() */
+    bool isDirty(const int index) const { return index < _dirty.size() && _dirty.testBit(index); }
+    /** True if the property changed since the last clearDirty() */
+    bool isDirty(const char* name) const { return isDirty(fieldIndex(name)); }
+    /** True if any property changed since the last clearDirty() */
+    bool hasDirtyFields() const { return _dirtyCount > 0; }
+    /** Names of the properties that changed since the last clearDirty() */
+    QList<QByteArray> dirtyFields() const;
+    /** Forget every change */
+    void clearDirty();
+
+private:
+    QBitArray _dirty;
+    int _dirtyCount = 0;
+};
+
+/** Mark the field dirty only when T is a QQmlDirtyTracker, the index is never looked up otherwise */
+template<bool tracked>
+struct QsmDirtyMarker
+{
+    template<typename T, typename Index>
+    static void mark(T*, Index) {}
+};
+
+/** Mark the field dirty only when T is a QQmlDirtyTracker, the index is never looked up otherwise */
+template<>
+struct QsmDirtyMarker<true>
+{
+    template<typename T, typename Index>
+    static void mark(T* object, Index index) { static_cast<QQmlDirtyTracker*>(object)->markDirty(index()); }
+};
+
+/** Mark the field of object dirty if object is a QQmlDirtyTracker */
+template<typename T, typename Index>
+inline void qsmMarkDirty(T* object, Index index)
+{
+    QsmDirtyMarker<std::is_base_of<QQmlDirtyTracker, T>::value>::mark(object, index);
+}
+
+/**
+ * \def QSM_MARK_DIRTY(name)
+ * \ingroup QSM_DIRTY_HELPER
+ * \hideinitializer
+ * \brief Mark the property `name` of `this` dirty. Does nothing if the class isn't a QQmlDirtyTracker.
+ * The property index is looked up once per setter.
+ * \param name Attribute name in lowerCamelCase
+ */
+#define QSM_MARK_DIRTY(name) \
+    QSUPERMACROS_NAMESPACE::qsmMarkDirty(this, []() -> int { static const int index = QSUPERMACROS_NAMESPACE::QQmlDirtyTracker::fieldIndex(#name); return index; })
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif // QQMLDIRTYTRACKER_H
@@ -6,13 +6,21 @@
 #ifndef QQMLHELPERSCOMMON_H
 #define QQMLHELPERSCOMMON_H
 
+#include <type_traits>
+#include <utility>
+
 #include <QtGlobal>
 #include <QQmlEngine>
 #include <QMetaEnum>
 #include <QMetaObject>
+#include <QPointF>
+#include <QSize>
 #include <qqml.h>
 
 #include <QSuperMacros.h>
+#include <QQmlDeferredNotify.h>
+#include <QQmlDirtyTracker.h>
+#include <QQmlNotifyBatch.h>
 
 /**
  * \defgroup QQML_HELPER_COMMON Common
@@ -23,32 +31,30 @@ QSUPERMACROS_NAMESPACE_START
 
 // NOTE : SFINAE trickery to find which type is the cheapest between T and const T &
 
+/**
+ * True if T is cheaper to pass by value than by `const T &`: trivially copyable and no bigger than two registers.
+ * Specialize it in QSUPERMACROS_NAMESPACE to override the choice for a type.
+ *
+ * \code
+ * QSUPERMACROS_NAMESPACE_START
+ * template<> struct QsmPassByValue<MyHandle> : std::true_type {};
+ * QSUPERMACROS_NAMESPACE_END
+ * \endcode
+ */
+template<typename T> struct QsmPassByValue : std::integral_constant<bool,
+    std::is_trivially_copyable<T>::value && sizeof(T) <= 2 * sizeof(void *)> {};
+
 /** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<typename T> struct CheapestType          { typedef const T & type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<bool>    { typedef bool      type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<quint8>  { typedef quint8    type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<quint16> { typedef quint16   type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<quint32> { typedef quint32   type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<quint64> { typedef quint64   type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<qint8>   { typedef qint8     type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<qint16>  { typedef qint16    type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<qint32>  { typedef qint32    type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<qint64>  { typedef qint64    type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<float>   { typedef float     type_def; };
-/** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<>           struct CheapestType<double>  { typedef double    type_def; };
+template<typename T, bool ByValue = QsmPassByValue<T>::value> struct CheapestType { typedef const T & type_def; };
 /** SFINAE trickery to find which type is the cheapest between T and const T & */
-template<typename T> struct CheapestType<T *>     { typedef T *       type_def; };
+template<typename T> struct CheapestType<T, true> { typedef T type_def; };
+
+static_assert(QsmPassByValue<bool>::value && QsmPassByValue<qint64>::value && QsmPassByValue<double>::value, "Scalars should be passed by value");
+static_assert(QsmPassByValue<QObject *>::value && QsmPassByValue<quint32>::value, "Pointers and integers should be passed by value");
+static_assert(QsmPassByValue<Qt::Orientation>::value, "Enums should be passed by value");
+static_assert(QsmPassByValue<QSize>::value, "Small value types should be passed by value");
+static_assert(QsmPassByValue<QPointF>::value == (sizeof(QPointF) <= 2 * sizeof(void *)), "QPointF should be passed by value where it fits in two registers");
+static_assert(!QsmPassByValue<QString>::value && !QsmPassByValue<QVariant>::value, "Implicitly shared types should be passed by const reference");
 
 // NOTE : Functions declaration Trick
 
@@ -137,6 +143,21 @@ template<typename T> struct CheapestType<T *>     { typedef T *       type_def;
 #   define QSM_MAKE_RESET_NAME(name, Name) Reset##Name
 #endif
 
+/**
+ * \def QSM_MAKE_BINDABLE_NAME(name, Name)
+ * \ingroup QQML_HELPER_COMMON
+ * \hideinitializer
+ * \brief Create a bindable accessor name in the qt naming convention `bindableName` if `QSUPERMACROS_USE_QT_BINDABLES` is set
+ * or non qt `BindableName`
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#ifdef QSUPERMACROS_USE_QT_BINDABLES
+#   define QSM_MAKE_BINDABLE_NAME(name, Name) bindable##Name
+#else
+#   define QSM_MAKE_BINDABLE_NAME(name, Name) Bindable##Name
+#endif
+
 /**
  * \def QSM_REGISTER_OBJ_TO_QML_NO_NAME(Type)
  * \ingroup QQML_HELPER_COMMON
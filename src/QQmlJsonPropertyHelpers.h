@@ -0,0 +1,513 @@
+/**
+ * \file QQmlJsonPropertyHelpers.h
+ * \brief Declare Auto Properties that are also json fields
+ */
+#ifndef QQMLJSONPROPERTYHELPERS_H
+#define QQMLJSONPROPERTYHELPERS_H
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QList>
+#include <QPointF>
+#include <QSizeF>
+#include <QStringList>
+#include <QUrl>
+#include <QVector>
+
+#include "QQmlAutoPropertyHelpers.h"
+#include "QJsonImportExport.h"
+
+QSUPERMACROS_NAMESPACE_START
+
+/**
+ * \defgroup QSM_JSON_HELPER Json Properties
+ * \brief Auto Properties registered at compile time in a per class field table.
+ * `jsonWrite` and `jsonRead` are generated from the table : no QMetaProperty nor QVariant is involved,
+ * keys are literals and each field is converted by a QsmJsonConverter picked by its type.
+ */
+
+// NOTE : Converters
+
+/**
+ * Convert a field to and from json, with `static QJsonValue toJson(const T&)` and `static bool fromJson(const QJsonValue&, T&)`.
+ * There is no generic implementation, so a field never fall back to a QVariant conversion :
+ * a type without specialization doesn't compile. Specialize it for custom types.
+ * `fromJson` return false and leave the value untouched if json doesn't hold a T.
+ * \ingroup QSM_JSON_HELPER
+ */
+template<typename T, typename Enable = void>
+struct QsmJsonConverter
+{
+    static_assert(sizeof(T) == 0, "Specialize QsmJsonConverter for this type");
+};
+
+/** \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<bool>
+{
+    static QJsonValue toJson(const bool value) { return value; }
+    static bool fromJson(const QJsonValue& json, bool& value) { value = json.toBool(); return json.isBool(); }
+};
+
+/** Integers up to 32 bits are json numbers. Fractional and out of range numbers are rejected. \ingroup QSM_JSON_HELPER */
+template<typename T>
+struct QsmJsonConverter<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value && (sizeof(T) <= 4)>::type>
+{
+    static QJsonValue toJson(const T value) { return double(value); }
+    static bool fromJson(const QJsonValue& json, T& value)
+    {
+        if (!json.isDouble())
+            return false;
+        const double number = json.toDouble();
+        if (number != std::floor(number) || number < double(std::numeric_limits<T>::min()) || number > double(std::numeric_limits<T>::max()))
+            return false;
+        value = T(number);
+        return true;
+    }
+};
+
+/** 64 bits integers are strings, like QJSONEXPORT_INT64, but exact numbers are accepted too. \ingroup QSM_JSON_HELPER */
+template<typename T>
+struct QsmJsonConverter<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value && (sizeof(T) > 4)>::type>
+{
+    static QJsonValue toJson(const T value) { return QSUPERMACROS_NAMESPACE::qJsonFromInt64(qint64(value)); }
+    static bool fromJson(const QJsonValue& json, T& value)
+    {
+        qint64 parsed = 0;
+        if (!QSUPERMACROS_NAMESPACE::qJsonToInt64(json, parsed))
+            return false;
+        value = T(parsed);
+        return true;
+    }
+};
+
+/** \ingroup QSM_JSON_HELPER */
+template<typename T>
+struct QsmJsonConverter<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && (sizeof(T) > 4)>::type>
+{
+    static QJsonValue toJson(const T value) { return QSUPERMACROS_NAMESPACE::qJsonFromUInt64(quint64(value)); }
+    static bool fromJson(const QJsonValue& json, T& value)
+    {
+        quint64 parsed = 0;
+        if (!QSUPERMACROS_NAMESPACE::qJsonToUInt64(json, parsed))
+            return false;
+        value = T(parsed);
+        return true;
+    }
+};
+
+/** Numbers out of the range of T are rejected. \ingroup QSM_JSON_HELPER */
+template<typename T>
+struct QsmJsonConverter<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    static QJsonValue toJson(const T value) { return double(value); }
+    static bool fromJson(const QJsonValue& json, T& value)
+    {
+        if (!json.isDouble())
+            return false;
+        const double number = json.toDouble();
+        if (number < double(std::numeric_limits<T>::lowest()) || number > double(std::numeric_limits<T>::max()))
+            return false;
+        value = T(number);
+        return true;
+    }
+};
+
+/** Enums are written as their underlying integer value, with its range checks. \ingroup QSM_JSON_HELPER */
+template<typename T>
+struct QsmJsonConverter<T, typename std::enable_if<std::is_enum<T>::value>::type>
+{
+    typedef typename std::underlying_type<T>::type Underlying;
+
+    static QJsonValue toJson(const T value) { return QsmJsonConverter<Underlying>::toJson(Underlying(value)); }
+    static bool fromJson(const QJsonValue& json, T& value)
+    {
+        Underlying underlying = 0;
+        if (!QsmJsonConverter<Underlying>::fromJson(json, underlying))
+            return false;
+        value = T(underlying);
+        return true;
+    }
+};
+
+/** \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QString>
+{
+    static QJsonValue toJson(const QString& value) { return value; }
+    static bool fromJson(const QJsonValue& json, QString& value) { if (!json.isString()) return false; value = json.toString(); return true; }
+};
+
+/** Bytes are base64 strings. \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QByteArray>
+{
+    static QJsonValue toJson(const QByteArray& value) { return QString::fromLatin1(value.toBase64()); }
+    static bool fromJson(const QJsonValue& json, QByteArray& value)
+    {
+        if (!json.isString())
+            return false;
+        value = QByteArray::fromBase64(json.toString().toLatin1());
+        return true;
+    }
+};
+
+/** \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QUrl>
+{
+    static QJsonValue toJson(const QUrl& value) { return value.toString(); }
+    static bool fromJson(const QJsonValue& json, QUrl& value) { if (!json.isString()) return false; value = QUrl(json.toString()); return true; }
+};
+
+/** Date times are ISO 8601 strings with milliseconds, an invalid date time is null. \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QDateTime>
+{
+    static QJsonValue toJson(const QDateTime& value)
+    {
+        return value.isValid() ? QJsonValue(value.toString(Qt::ISODateWithMs)) : QJsonValue(QJsonValue::Null);
+    }
+    static bool fromJson(const QJsonValue& json, QDateTime& value)
+    {
+        if (json.isNull())
+        {
+            value = QDateTime();
+            return true;
+        }
+        if (!json.isString())
+            return false;
+        const QDateTime parsed = QDateTime::fromString(json.toString(), Qt::ISODateWithMs);
+        if (!parsed.isValid())
+            return false;
+        value = parsed;
+        return true;
+    }
+};
+
+/** Points are `{"x": 0, "y": 0}` objects. \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QPointF>
+{
+    static QJsonValue toJson(const QPointF& value) { return QJsonObject{ { QStringLiteral("x"), value.x() }, { QStringLiteral("y"), value.y() } }; }
+    static bool fromJson(const QJsonValue& json, QPointF& value)
+    {
+        const QJsonValue x = json.toObject().value(QLatin1String("x"));
+        const QJsonValue y = json.toObject().value(QLatin1String("y"));
+        if (!x.isDouble() || !y.isDouble())
+            return false;
+        value = QPointF(x.toDouble(), y.toDouble());
+        return true;
+    }
+};
+
+/** Sizes are `{"width": 0, "height": 0}` objects. \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QSizeF>
+{
+    static QJsonValue toJson(const QSizeF& value) { return QJsonObject{ { QStringLiteral("width"), value.width() }, { QStringLiteral("height"), value.height() } }; }
+    static bool fromJson(const QJsonValue& json, QSizeF& value)
+    {
+        const QJsonValue width = json.toObject().value(QLatin1String("width"));
+        const QJsonValue height = json.toObject().value(QLatin1String("height"));
+        if (!width.isDouble() || !height.isDouble())
+            return false;
+        value = QSizeF(width.toDouble(), height.toDouble());
+        return true;
+    }
+};
+
+/** Sequences are arrays, read only if every element has the right type \internal */
+template<typename Container, typename T>
+struct QsmJsonSequenceConverter
+{
+    static QJsonValue toJson(const Container& value)
+    {
+        QJsonArray json;
+        for (const T& element : value)
+            json.append(QsmJsonConverter<T>::toJson(element));
+        return json;
+    }
+    static bool fromJson(const QJsonValue& json, Container& value)
+    {
+        if (!json.isArray())
+            return false;
+        const QJsonArray array = json.toArray();
+        Container parsed;
+        parsed.reserve(array.size());
+        for (const QJsonValue& element : array)
+        {
+            T parsedElement{};
+            if (!QsmJsonConverter<T>::fromJson(element, parsedElement))
+                return false;
+            parsed.append(parsedElement);
+        }
+        value = parsed;
+        return true;
+    }
+};
+
+/** \ingroup QSM_JSON_HELPER */
+template<typename T>
+struct QsmJsonConverter<QList<T>> : QsmJsonSequenceConverter<QList<T>, T> {};
+
+#if QT_VERSION < QT_VERSION_CHECK(6, 0, 0)
+/** QVector and QStringList are QList in Qt 6. \ingroup QSM_JSON_HELPER */
+template<typename T>
+struct QsmJsonConverter<QVector<T>> : QsmJsonSequenceConverter<QVector<T>, T> {};
+
+/** \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QStringList> : QsmJsonSequenceConverter<QStringList, QString> {};
+#endif
+
+/** \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QJsonValue>
+{
+    static QJsonValue toJson(const QJsonValue& value) { return value; }
+    static bool fromJson(const QJsonValue& json, QJsonValue& value) { value = json; return true; }
+};
+
+/** \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QJsonObject>
+{
+    static QJsonValue toJson(const QJsonObject& value) { return value; }
+    static bool fromJson(const QJsonValue& json, QJsonObject& value) { value = json.toObject(); return json.isObject(); }
+};
+
+/** \ingroup QSM_JSON_HELPER */
+template<>
+struct QsmJsonConverter<QJsonArray>
+{
+    static QJsonValue toJson(const QJsonArray& value) { return value; }
+    static bool fromJson(const QJsonValue& json, QJsonArray& value) { value = json.toArray(); return json.isArray(); }
+};
+
+/**
+ * Pointers to QJsonImportExport are nested objects.
+ * Reading fill the pointed object, the pointer itself is never set.
+ * \ingroup QSM_JSON_HELPER
+ */
+template<typename T>
+struct QsmJsonConverter<T*, typename std::enable_if<std::is_base_of<QJsonExportable, T>::value && std::is_base_of<QJsonImportable, T>::value>::type>
+{
+    static QJsonValue toJson(const T* value)
+    {
+        if (!value)
+            return QJsonValue(QJsonValue::Null);
+        QJsonObject json;
+        value->jsonWrite(json);
+        return json;
+    }
+    static bool fromJson(const QJsonValue& json, T*& value)
+    {
+        if (value && json.isObject())
+            value->jsonRead(json.toObject());
+        return false;
+    }
+};
+
+// NOTE : Compile time field table
+
+/** Maximum number of json fields per class */
+static const int QsmJsonMaxFields = 128;
+
+/** Overload rank, QsmJsonRank<N> is a better match than QsmJsonRank<N - 1> \internal */
+template<int N> struct QsmJsonRank : QsmJsonRank<N - 1> {};
+/** \internal */
+template<> struct QsmJsonRank<0> {};
+/** Number of fields declared so far \internal */
+template<int N> struct QsmJsonCount { static const int value = N; };
+/** Tag of the field at index I \internal */
+template<int I> struct QsmJsonIndex {};
+
+/** Walk the fields [I, N[ of T \internal */
+template<typename T, int I, int N>
+struct QsmJsonFields
+{
+    static void write(const T* object, QJsonObject& json)
+    {
+        object->_qsmJsonWriteField(QsmJsonIndex<I>(), json);
+        QsmJsonFields<T, I + 1, N>::write(object, json);
+    }
+    static void read(T* object, const QJsonObject& json)
+    {
+        object->_qsmJsonReadField(QsmJsonIndex<I>(), json);
+        QsmJsonFields<T, I + 1, N>::read(object, json);
+    }
+    static void writeDirty(const T* object, const QQmlDirtyTracker& tracker, QJsonObject& json)
+    {
+        object->_qsmJsonWriteDirtyField(QsmJsonIndex<I>(), tracker, json);
+        QsmJsonFields<T, I + 1, N>::writeDirty(object, tracker, json);
+    }
+};
+
+/** \internal */
+template<typename T, int N>
+struct QsmJsonFields<T, N, N>
+{
+    static void write(const T*, QJsonObject&) {}
+    static void read(T*, const QJsonObject&) {}
+    static void writeDirty(const T*, const QQmlDirtyTracker&, QJsonObject&) {}
+};
+
+/**
+ * \def QSM_JSON_FIELD_COUNT
+ * \ingroup QSM_JSON_HELPER
+ * \hideinitializer
+ * \brief Number of json fields declared so far in the class \internal
+ */
+#define QSM_JSON_FIELD_COUNT \
+    decltype(_qsmJsonCounter(QSUPERMACROS_NAMESPACE::QsmJsonRank<QSUPERMACROS_NAMESPACE::QsmJsonMaxFields>()))::value
+
+/**
+ * \def QSM_JSON_SERIALIZABLE(Type)
+ * \ingroup QSM_JSON_HELPER
+ * \hideinitializer
+ * \brief Start the json field table of the class, and generate `jsonWrite`, `jsonRead`, `jsonReadPatch` and `jsonWriteDirty` from it.
+ * Fields are read independently, so `jsonReadPatch` only read the diff.
+ * Must come before any `QSM_JSON_*_PROPERTY`. The class must inherit QJsonImportExport.
+ * \param Type Class Name
+ *
+ * \code
+ * class MyObject : public QObject, public QJsonImportExport
+ * {
+ *     Q_OBJECT
+ *     QSM_JSON_SERIALIZABLE(MyObject)
+ *     QSM_JSON_WRITABLE_AUTO_PROPERTY(int, x, X);
+ *     QSM_JSON_WRITABLE_AUTO_PROPERTY_WDEFAULT(QString, label, Label, "none");
+ * };
+ * \endcode
+ */
+#define QSM_JSON_SERIALIZABLE(Type) \
+    private: \
+        static QSUPERMACROS_NAMESPACE::QsmJsonCount<0> _qsmJsonCounter(QSUPERMACROS_NAMESPACE::QsmJsonRank<0>); \
+        template<typename, int, int> friend struct QSUPERMACROS_NAMESPACE::QsmJsonFields; \
+    public: \
+        void jsonWrite(QJsonObject& json) const override \
+        { \
+            QSUPERMACROS_NAMESPACE::QsmJsonFields<Type, 0, QSM_JSON_FIELD_COUNT>::write(this, json); \
+        } \
+        void jsonRead(const QJsonObject& json) override \
+        { \
+            QSUPERMACROS_NAMESPACE::QsmJsonFields<Type, 0, QSM_JSON_FIELD_COUNT>::read(this, json); \
+        } \
+        void jsonReadPatch(const QJsonObject& diff, const QJsonObject&) override \
+        { \
+            jsonRead(diff); \
+        } \
+        bool jsonWriteDirty(const QSUPERMACROS_NAMESPACE::QQmlDirtyTracker& tracker, QJsonObject& json) const override \
+        { \
+            QSUPERMACROS_NAMESPACE::QsmJsonFields<Type, 0, QSM_JSON_FIELD_COUNT>::writeDirty(this, tracker, json); \
+            return true; \
+        } \
+    private:
+
+/**
+ * \def QSM_JSON_SERIALIZABLE_DERIVED(Type, Base)
+ * \ingroup QSM_JSON_HELPER
+ * \hideinitializer
+ * \brief Same as QSM_JSON_SERIALIZABLE, the fields of Base are written and read first
+ * \param Type Class Name
+ * \param Base Base class, that is itself serializable
+ */
+#define QSM_JSON_SERIALIZABLE_DERIVED(Type, Base) \
+    private: \
+        static QSUPERMACROS_NAMESPACE::QsmJsonCount<0> _qsmJsonCounter(QSUPERMACROS_NAMESPACE::QsmJsonRank<0>); \
+        template<typename, int, int> friend struct QSUPERMACROS_NAMESPACE::QsmJsonFields; \
+    public: \
+        void jsonWrite(QJsonObject& json) const override \
+        { \
+            Base::jsonWrite(json); \
+            QSUPERMACROS_NAMESPACE::QsmJsonFields<Type, 0, QSM_JSON_FIELD_COUNT>::write(this, json); \
+        } \
+        void jsonRead(const QJsonObject& json) override \
+        { \
+            Base::jsonRead(json); \
+            QSUPERMACROS_NAMESPACE::QsmJsonFields<Type, 0, QSM_JSON_FIELD_COUNT>::read(this, json); \
+        } \
+        void jsonReadPatch(const QJsonObject& diff, const QJsonObject&) override \
+        { \
+            jsonRead(diff); \
+        } \
+        bool jsonWriteDirty(const QSUPERMACROS_NAMESPACE::QQmlDirtyTracker& tracker, QJsonObject& json) const override \
+        { \
+            if (!Base::jsonWriteDirty(tracker, json)) \
+                return false; \
+            QSUPERMACROS_NAMESPACE::QsmJsonFields<Type, 0, QSM_JSON_FIELD_COUNT>::writeDirty(this, tracker, json); \
+            return true; \
+        } \
+    private:
+
+/**
+ * \def QSM_JSON_FIELD(type, name, Name)
+ * \ingroup QSM_JSON_HELPER
+ * \hideinitializer
+ * \brief Append the attribute `name` to the json field table, with `#name` as key.
+ * Reading call the setter, so signals and dirty tracking behave as usual.
+ * \param type Type of the attribute
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_JSON_FIELD(type, name, Name) \
+    private: \
+        static const int _qsmJsonIndex_##name = QSM_JSON_FIELD_COUNT; \
+        static_assert(_qsmJsonIndex_##name < QSUPERMACROS_NAMESPACE::QsmJsonMaxFields, "Too many json fields"); \
+        static QSUPERMACROS_NAMESPACE::QsmJsonCount<_qsmJsonIndex_##name + 1> _qsmJsonCounter(QSUPERMACROS_NAMESPACE::QsmJsonRank<_qsmJsonIndex_##name + 1>); \
+        void _qsmJsonWriteField(QSUPERMACROS_NAMESPACE::QsmJsonIndex<_qsmJsonIndex_##name>, QJsonObject& json) const \
+        { \
+            json.insert(QStringLiteral(#name), QSUPERMACROS_NAMESPACE::QsmJsonConverter<type>::toJson(QSM_MAKE_ATTRIBUTE_NAME(name, Name))); \
+        } \
+        void _qsmJsonWriteDirtyField(QSUPERMACROS_NAMESPACE::QsmJsonIndex<_qsmJsonIndex_##name> field, const QSUPERMACROS_NAMESPACE::QQmlDirtyTracker& tracker, QJsonObject& json) const \
+        { \
+            static const int dirtyIndex = QSUPERMACROS_NAMESPACE::QQmlDirtyTracker::fieldIndex(#name); \
+            if (tracker.isDirty(dirtyIndex)) \
+                _qsmJsonWriteField(field, json); \
+        } \
+        void _qsmJsonReadField(QSUPERMACROS_NAMESPACE::QsmJsonIndex<_qsmJsonIndex_##name>, const QJsonObject& json) \
+        { \
+            const auto it = json.constFind(QLatin1String(#name)); \
+            if (it == json.constEnd()) \
+                return; \
+            type value(QSM_MAKE_ATTRIBUTE_NAME(name, Name)); \
+            if (QSUPERMACROS_NAMESPACE::QsmJsonConverter<type>::fromJson(it.value(), value)) \
+                QSM_MAKE_SETTER_NAME(name, Name) (value); \
+        } \
+    private:
+
+/**
+ * Generate a **Writable** Auto Property that is also a json field
+ * \ingroup QSM_JSON_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase, also the json key
+ * \param Name Attribute name in UpperCamelCase
+ * \param def Default value of the members. If you want to let the type choose default value just use `{}`
+ */
+#define QSM_JSON_WRITABLE_AUTO_PROPERTY_WDEFAULT(type, name, Name, def) \
+    QSM_WRITABLE_AUTO_PROPERTY_WDEFAULT(type, name, Name, def) \
+    QSM_JSON_FIELD(type, name, Name)
+
+/**
+ * Generate a **Writable** Auto Property that is also a json field
+ * \ingroup QSM_JSON_HELPER
+ * \hideinitializer
+ * \param type Type of the attribute (`int`, `quint32`, `QString`, etc...)
+ * \param name Attribute name in lowerCamelCase, also the json key
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_JSON_WRITABLE_AUTO_PROPERTY(type, name, Name) \
+    QSM_JSON_WRITABLE_AUTO_PROPERTY_WDEFAULT(type, name, Name, {})
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif // QQMLJSONPROPERTYHELPERS_H
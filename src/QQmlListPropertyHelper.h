@@ -29,6 +29,11 @@ public:
     typedef QQmlSmartListWrapper<ObjType> SmartListWrapperType;
 
     typedef typename CppListType::const_iterator const_iterator;
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    typedef qsizetype SizeType;
+#else
+    typedef int SizeType;
+#endif
 
     explicit QQmlSmartListWrapper (QObject * object, const int reserve = 0)
         : QmlListPropertyType
@@ -64,7 +69,7 @@ public:
         return m_items.constEnd ();
     }
 
-    static int callbackCount (QmlListPropertyType * prop) {
+    static SizeType callbackCount (QmlListPropertyType * prop) {
         return static_cast<CppListType *> (prop->data)->count ();
     }
 
@@ -76,7 +81,7 @@ public:
         static_cast<CppListType *> (prop->data)->append (obj);
     }
 
-    static ObjType * callbackAt (QmlListPropertyType * prop, int idx) {
+    static ObjType * callbackAt (QmlListPropertyType * prop, SizeType idx) {
         return static_cast<CppListType *> (prop->data)->at (idx);
     }
 
@@ -0,0 +1,62 @@
+#include "QQmlNotifyBatch.h"
+
+QSUPERMACROS_USING_NAMESPACE
+
+/** Innermost batch open in the thread, batches are chained to the previous one */
+static thread_local QQmlNotifyBatch* currentBatch = nullptr;
+
+QQmlNotifyBatch::QQmlNotifyBatch(QObject* object) :
+	_object(object),
+	_outer(find(object)),
+	_previous(currentBatch)
+{
+	currentBatch = this;
+}
+
+QQmlNotifyBatch::~QQmlNotifyBatch()
+{
+	Q_ASSERT(currentBatch == this);
+	// Signals emitted while closing aren't deferred anymore
+	currentBatch = _previous;
+	flush();
+}
+
+void QQmlNotifyBatch::flush()
+{
+	if (_emitters.isEmpty())
+		return;
+
+	// Swap first, an emitter can call setters that defer again
+	QVector<std::function<void()>> emitters;
+	emitters.swap(_emitters);
+	_deferred.fill(false);
+
+	for (const auto& emitter : emitters)
+	{
+		// A slot can destroy the object
+		if (!_object)
+			return;
+		emitter();
+	}
+}
+
+QQmlNotifyBatch* QQmlNotifyBatch::find(const QObject* object)
+{
+	for (QQmlNotifyBatch* batch = currentBatch; batch; batch = batch->_previous)
+	{
+		if (batch->_object == object)
+			return batch->_outer ? batch->_outer : batch;
+	}
+	return nullptr;
+}
+
+void QQmlNotifyBatch::defer(const int index, const std::function<void()>& emitter)
+{
+	if (index >= _deferred.size())
+		_deferred.resize(index + 1);
+	if (_deferred.testBit(index))
+		return;
+
+	_deferred.setBit(index);
+	_emitters.append(emitter);
+}
@@ -0,0 +1,97 @@
+/**
+ * \file QQmlNotifyBatch.h
+ * \brief Coalesce the change signals of an object while a batch is open
+ */
+#ifndef QQMLNOTIFYBATCH_H
+#define QQMLNOTIFYBATCH_H
+
+#include <functional>
+
+#include <QBitArray>
+#include <QObject>
+#include <QPointer>
+#include <QVector>
+
+#include <QSuperMacros.h>
+#include <QQmlDirtyTracker.h>
+
+QSUPERMACROS_NAMESPACE_START
+
+/**
+ * Scope that defer the change signals of the generated setters of an object.
+ * While it is open, a setter that change its value doesn't emit, it records its property.
+ * When the scope close, every changed property emits once, with its final value,
+ * so bindings are evaluated once against a consistent object.
+ * \ingroup QSM_DIRTY_HELPER
+ *
+ * * The batch only defer the setters called on object, in the thread that opened it.
+ * * A batch opened on an object that already has one join it, the outermost batch emits.
+ * * A property set back to its first value still emits.
+ * * Signals emitted while closing are not batched, and stop if the object is destroyed.
+ *
+ * \code
+ * {
+ *     QQmlNotifyBatch batch(&object);
+ *     object.setX(12);
+ *     object.setY(13);
+ *     object.setX(14);
+ * } // xChanged(14) then yChanged(13)
+ * \endcode
+ */
+class QSUPERMACROS_API_ QQmlNotifyBatch
+{
+public:
+    /** Open a batch on object in the current thread */
+    explicit QQmlNotifyBatch(QObject* object);
+    /** Close the batch and emit the deferred signals */
+    ~QQmlNotifyBatch();
+
+public:
+    /** Number of properties whose signal is deferred */
+    int pendingCount() const { return _emitters.size(); }
+    /** Emit the deferred signals now, the batch stay open */
+    void flush();
+
+    /** Batch open on object in the current thread, nullptr if there is none */
+    static QQmlNotifyBatch* find(const QObject* object);
+    /** Call emitter when the batch close. Only the first emitter of a property index is kept */
+    void defer(const int index, const std::function<void()>& emitter);
+
+private:
+    Q_DISABLE_COPY(QQmlNotifyBatch)
+
+private:
+    QPointer<QObject> _object;
+    QQmlNotifyBatch* _outer = nullptr;
+    QQmlNotifyBatch* _previous = nullptr;
+    QBitArray _deferred;
+    QVector<std::function<void()>> _emitters;
+};
+
+/** Call emitter now, or when the batch open on object close. The index is only looked up inside a batch */
+template<typename T, typename Index, typename Emitter>
+inline void qsmEmitChanged(T* object, Index index, const Emitter& emitter)
+{
+    if (QQmlNotifyBatch* batch = QQmlNotifyBatch::find(object))
+        batch->defer(index(), emitter);
+    else
+        emitter();
+}
+
+/**
+ * \def QSM_EMIT_CHANGED(name, Name)
+ * \ingroup QSM_DIRTY_HELPER
+ * \hideinitializer
+ * \brief Emit the change signal of the property `name` of `this` with its value,
+ * or defer it if a QQmlNotifyBatch is open on `this`.
+ * \param name Attribute name in lowerCamelCase
+ * \param Name Attribute name in UpperCamelCase
+ */
+#define QSM_EMIT_CHANGED(name, Name) \
+    QSUPERMACROS_NAMESPACE::qsmEmitChanged(this, \
+        []() -> int { static const int index = QSUPERMACROS_NAMESPACE::QQmlDirtyTracker::fieldIndex(#name); return index; }, \
+        [this]() { Q_EMIT QSM_MAKE_SIGNAL_NAME(name, Name) (QSM_MAKE_ATTRIBUTE_NAME(name, Name)); })
+
+QSUPERMACROS_NAMESPACE_END
+
+#endif // QQMLNOTIFYBATCH_H
@@ -79,7 +79,7 @@ QSUPERMACROS_NAMESPACE_START
     { \
         if (QSM_MAKE_ATTRIBUTE_NAME(name, Name) != name) { \
             QSM_MAKE_ATTRIBUTE_NAME(name, Name) = name; \
-            emit QSM_MAKE_SIGNAL_NAME(name, Name) (QSM_MAKE_ATTRIBUTE_NAME(name, Name)); \
+            QSM_EMIT_CHANGED(name, Name); \
             return true; \
         } \
         else \
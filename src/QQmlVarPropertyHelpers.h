@@ -73,13 +73,16 @@ QSUPERMACROS_NAMESPACE_START
  *              return false;
  *      }
  *  \endcode
+ *
+ * When the class inherit QQmlDirtyTracker, a change also mark the property dirty.
  */
 #define QSM_VAR_SETTER(type, name, Name) \
     bool QSM_MAKE_SETTER_NAME(name, Name) (const type name) \
     { \
         if (QSM_MAKE_ATTRIBUTE_NAME(name, Name) != name) { \
             QSM_MAKE_ATTRIBUTE_NAME(name, Name) = name; \
-            emit QSM_MAKE_SIGNAL_NAME(name, Name) (QSM_MAKE_ATTRIBUTE_NAME(name, Name)); \
+            QSM_MARK_DIRTY(name); \
+            QSM_EMIT_CHANGED(name, Name); \
             return true; \
         } \
         else \
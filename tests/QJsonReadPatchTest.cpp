@@ -0,0 +1,117 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QtTest>
+
+#include <QJsonHotReload.h>
+#include <QJsonMetaSerializer.h>
+#include <QQmlJsonPropertyHelpers.h>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Json fields whose setters count their calls */
+class FieldTable : public QJsonImportExport
+{
+	QSM_JSON_SERIALIZABLE(FieldTable)
+
+public:
+	int xSets = 0;
+	int labelSets = 0;
+
+	bool setX(const int x) { ++xSets; _x = x; return true; }
+	bool setLabel(const QString& label) { ++labelSets; _label = label; return true; }
+
+private:
+	int _x = 0;
+	QString _label;
+	QSM_JSON_FIELD(int, x, X)
+	QSM_JSON_FIELD(QString, label, Label)
+};
+
+/** Meta properties whose setters count their calls */
+class MetaObject : public QObject, public QJsonImportExport
+{
+	Q_OBJECT
+	QJSONMETA_IMPORTEXPORT
+	Q_PROPERTY(int x READ x WRITE setX)
+	Q_PROPERTY(QString label READ label WRITE setLabel)
+
+public:
+	int xSets = 0;
+	int labelSets = 0;
+
+	int x() const { return _x; }
+	void setX(const int x) { ++xSets; _x = x; }
+	QString label() const { return _label; }
+	void setLabel(const QString& label) { ++labelSets; _label = label; }
+
+private:
+	int _x = 0;
+	QString _label;
+};
+
+class QJsonReadPatchTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void fieldTable();
+	void metaSerializer();
+};
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+static QJsonObject previousDocument()
+{
+	return QJsonObject{ { QStringLiteral("x"), 1 }, { QStringLiteral("label"), QStringLiteral("one") } };
+}
+
+static QJsonObject currentDocument()
+{
+	return QJsonObject{ { QStringLiteral("x"), 2 }, { QStringLiteral("label"), QStringLiteral("one") } };
+}
+
+void QJsonReadPatchTest::fieldTable()
+{
+	FieldTable object;
+	object.jsonRead(previousDocument());
+	object.xSets = 0;
+	object.labelSets = 0;
+
+	const QJsonObject document = currentDocument();
+	const QJsonObject diff = QJsonHotReload::diff(previousDocument(), document);
+	QCOMPARE(diff, QJsonObject({ { QStringLiteral("x"), 2 } }));
+
+	object.jsonReadPatch(diff, document);
+	QCOMPARE(object.xSets, 1);
+	QCOMPARE(object.labelSets, 0);
+
+	QJsonObject json;
+	object.jsonWrite(json);
+	QCOMPARE(json, document);
+}
+
+void QJsonReadPatchTest::metaSerializer()
+{
+	MetaObject object;
+	object.jsonRead(previousDocument());
+	object.xSets = 0;
+	object.labelSets = 0;
+
+	const QJsonObject document = currentDocument();
+	object.jsonReadPatch(QJsonHotReload::diff(previousDocument(), document), document);
+	QCOMPARE(object.xSets, 1);
+	QCOMPARE(object.labelSets, 0);
+	QCOMPARE(object.x(), 2);
+	QCOMPARE(object.label(), QStringLiteral("one"));
+}
+
+QTEST_GUILESS_MAIN(QJsonReadPatchTest)
+#include "QJsonReadPatchTest.moc"
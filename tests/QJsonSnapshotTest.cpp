@@ -0,0 +1,180 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QTemporaryFile>
+#include <QtEndian>
+#include <QtTest>
+
+#include <QJsonSnapshot.h>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+class QJsonSnapshotTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void roundTrip();
+	void roundTripFile();
+	void truncated();
+	void selfPointer();
+	void forwardPointer();
+	void outOfRangeOffset();
+};
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+static QJsonObject document()
+{
+	return QJsonObject{
+		{ QStringLiteral("name"), QStringLiteral("snapshot \u00e9") },
+		{ QStringLiteral("count"), 42 },
+		{ QStringLiteral("ratio"), 0.25 },
+		{ QStringLiteral("enabled"), true },
+		{ QStringLiteral("none"), QJsonValue(QJsonValue::Null) },
+		{ QStringLiteral("list"), QJsonArray{ 1, QStringLiteral("two"), QJsonArray{ 3 }, QJsonObject{ { QStringLiteral("name"), 4 } } } },
+		{ QStringLiteral("child"), QJsonObject{ { QStringLiteral("a"), 1 }, { QStringLiteral("b"), QJsonObject{} } } },
+	};
+}
+
+static quint32 readUInt32(const QByteArray& data, const int offset)
+{
+	return qFromLittleEndian<quint32>(reinterpret_cast<const uchar*>(data.constData() + offset));
+}
+
+static void writeUInt32(QByteArray& data, const int offset, const quint32 value)
+{
+	qToLittleEndian<quint32>(value, reinterpret_cast<uchar*>(data.data() + offset));
+}
+
+static void writeUInt64(QByteArray& data, const int offset, const quint64 value)
+{
+	qToLittleEndian<quint64>(value, reinterpret_cast<uchar*>(data.data() + offset));
+}
+
+/** Snapshot of {"child": {"a": 1}}, and the offset of the payload of its only root member */
+static QByteArray childSnapshot(int& payloadOffset)
+{
+	const QByteArray data = QJsonSnapshot::fromJson(QJsonObject{ { QStringLiteral("child"), QJsonObject{ { QStringLiteral("a"), 1 } } } });
+	// Root record : count, reserved, then the member : key offset, type, payload
+	payloadOffset = int(readUInt32(data, 8)) + 8 + 8;
+	return data;
+}
+
+void QJsonSnapshotTest::roundTrip()
+{
+	QJsonSnapshot snapshot;
+	QVERIFY(snapshot.setData(QJsonSnapshot::fromJson(document())));
+	QCOMPARE(snapshot.root().toJsonObject(), document());
+
+	const QJsonSnapshotObject root = snapshot.root();
+	QCOMPARE(root.value(QLatin1String("count")).toInt(), 42);
+	QCOMPARE(root.value(QStringLiteral("name")).toString(), QStringLiteral("snapshot \u00e9"));
+	QCOMPARE(root.value(QLatin1String("child")).toObject().value(QLatin1String("a")).toInt(), 1);
+	QCOMPARE(root.value(QLatin1String("list")).toArray().size(), 4);
+	QVERIFY(root.value(QLatin1String("missing")).isUndefined());
+}
+
+void QJsonSnapshotTest::roundTripFile()
+{
+	QTemporaryFile file;
+	QVERIFY(file.open());
+	file.write(QJsonSnapshot::fromJson(document()));
+	file.close();
+
+	QJsonSnapshot snapshot;
+	QVERIFY(snapshot.open(file.fileName()));
+	QCOMPARE(snapshot.root().toJsonObject(), document());
+}
+
+void QJsonSnapshotTest::truncated()
+{
+	const QByteArray data = QJsonSnapshot::fromJson(document());
+	// The root is written last, so every truncation cut it
+	for (int size = 0; size < data.size(); ++size)
+	{
+		QJsonSnapshot snapshot;
+		if (!snapshot.setData(data.left(size)))
+		{
+			QVERIFY(size < 16);
+			continue;
+		}
+		QVERIFY(snapshot.root().isEmpty());
+		QCOMPARE(snapshot.root().toJsonObject(), QJsonObject());
+	}
+}
+
+void QJsonSnapshotTest::selfPointer()
+{
+	int payloadOffset = 0;
+	QByteArray data = childSnapshot(payloadOffset);
+	writeUInt64(data, payloadOffset, readUInt32(data, 8));
+
+	QJsonSnapshot snapshot;
+	QVERIFY(snapshot.setData(data));
+	const QJsonSnapshotValue child = snapshot.root().value(QLatin1String("child"));
+	QVERIFY(child.isObject());
+	QVERIFY(child.toObject().isEmpty());
+	QCOMPARE(snapshot.root().toJsonObject(), QJsonObject({ { QStringLiteral("child"), QJsonObject() } }));
+}
+
+void QJsonSnapshotTest::forwardPointer()
+{
+	int payloadOffset = 0;
+	QByteArray data = childSnapshot(payloadOffset);
+	writeUInt64(data, payloadOffset, readUInt32(data, 8) + 8);
+
+	QJsonSnapshot snapshot;
+	QVERIFY(snapshot.setData(data));
+	QVERIFY(snapshot.root().value(QLatin1String("child")).toObject().isEmpty());
+	QVERIFY(snapshot.root().value(QLatin1String("child")).toArray().isEmpty());
+}
+
+void QJsonSnapshotTest::outOfRangeOffset()
+{
+	// Root record past the end of the file
+	{
+		QByteArray data = QJsonSnapshot::fromJson(document());
+		writeUInt32(data, 8, quint32(data.size()) + 64);
+		QJsonSnapshot snapshot;
+		QVERIFY(snapshot.setData(data));
+		QVERIFY(snapshot.root().isEmpty());
+	}
+
+	// String payloads past the end of the file, or wider than an offset
+	{
+		QByteArray data = QJsonSnapshot::fromJson(QJsonObject{ { QStringLiteral("name"), QStringLiteral("value") } });
+		const int payloadOffset = int(readUInt32(data, 8)) + 8 + 8;
+		QJsonSnapshot snapshot;
+
+		writeUInt64(data, payloadOffset, 0xFFFFFFF0u);
+		QVERIFY(snapshot.setData(data));
+		QVERIFY(snapshot.root().value(QLatin1String("name")).isString());
+		QVERIFY(snapshot.root().value(QLatin1String("name")).toString().isEmpty());
+
+		writeUInt64(data, payloadOffset, Q_UINT64_C(0x100000000));
+		QVERIFY(snapshot.setData(data));
+		QVERIFY(snapshot.root().value(QLatin1String("name")).toString().isEmpty());
+	}
+
+	// Child record whose count run past the end of the file
+	{
+		int payloadOffset = 0;
+		QByteArray data = childSnapshot(payloadOffset);
+		const quint32 child = quint32(qFromLittleEndian<quint64>(reinterpret_cast<const uchar*>(data.constData() + payloadOffset)));
+		writeUInt32(data, int(child), 0x10000000u);
+		QJsonSnapshot snapshot;
+		QVERIFY(snapshot.setData(data));
+		QVERIFY(snapshot.root().value(QLatin1String("child")).toObject().isEmpty());
+	}
+}
+
+QTEST_GUILESS_MAIN(QJsonSnapshotTest)
+#include "QJsonSnapshotTest.moc"
@@ -0,0 +1,277 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <cmath>
+
+#include <QBuffer>
+#include <QtTest>
+
+#include <QJsonImportExport.h>
+#include <QJsonStreamReader.h>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Child read with the streaming import macros */
+class StreamedChild : public QJsonImportable
+{
+public:
+	int value = 0;
+	void setValue(const int v) { value = v; }
+
+	bool jsonStreamRead(QJsonStreamReader& reader) override
+	{
+		QJSONSTREAMIMPORT_BEGIN
+		QJSONSTREAMIMPORT_INT("value", setValue)
+		QJSONSTREAMIMPORT_END
+	}
+};
+
+/** Object read with the streaming import macros */
+class Streamed : public QJsonImportable
+{
+public:
+	int x = 0;
+	QString name;
+	bool enabled = false;
+	qint64 big = 0;
+	StreamedChild child;
+	QList<int> children;
+
+	void setX(const int v) { x = v; }
+	void setName(const QString& v) { name = v; }
+	void setEnabled(const bool v) { enabled = v; }
+	void setBig(const qint64 v) { big = v; }
+
+	bool jsonStreamRead(QJsonStreamReader& reader) override
+	{
+		StreamedChild* childPtr = &child;
+		QJSONSTREAMIMPORT_BEGIN
+		QJSONSTREAMIMPORT_INT("x", setX)
+		QJSONSTREAMIMPORT_STRING("name", setName)
+		QJSONSTREAMIMPORT_BOOL("enabled", setEnabled)
+		QJSONSTREAMIMPORT_INT64("big", setBig)
+		QJSONSTREAMIMPORT_OBJECT("child", childPtr)
+		QJSONSTREAMIMPORT_ARRAY_OBJECT("children",
+			StreamedChild element;
+			StreamedChild* elementPtr = &element;
+			QJSONSTREAMIMPORT_OBJECT_FROMARRAY(elementPtr)
+			children.append(element.value))
+		QJSONSTREAMIMPORT_END
+	}
+};
+
+/** Object that only implement jsonRead(), to check the default jsonStreamRead() */
+class Buffered : public QJsonImportable
+{
+public:
+	int reads = 0;
+	QJsonObject last;
+
+	void jsonRead(const QJsonObject& json) override
+	{
+		++reads;
+		last = json;
+	}
+};
+
+class QJsonStreamReaderTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void tokens();
+	void tokensFromDevice();
+	void numbers_data();
+	void numbers();
+	void skipValue_data();
+	void skipValue();
+	void streamImportMacros();
+	void defaultStreamReadBuildOneObject();
+};
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+static QList<QJsonStreamReader::TokenType> readTokens(QJsonStreamReader& reader)
+{
+	QList<QJsonStreamReader::TokenType> tokens;
+	while (!reader.atEnd())
+		tokens.append(reader.readNext());
+	return tokens;
+}
+
+void QJsonStreamReaderTest::tokens()
+{
+	QJsonStreamReader reader(QByteArray(R"({"a": [1, "two", true, null], "b": {}})"));
+	const QList<QJsonStreamReader::TokenType> expected = {
+		QJsonStreamReader::StartObject,
+		QJsonStreamReader::Name, QJsonStreamReader::StartArray,
+		QJsonStreamReader::Number, QJsonStreamReader::String, QJsonStreamReader::Bool, QJsonStreamReader::Null,
+		QJsonStreamReader::EndArray,
+		QJsonStreamReader::Name, QJsonStreamReader::StartObject, QJsonStreamReader::EndObject,
+		QJsonStreamReader::EndObject,
+		QJsonStreamReader::EndDocument
+	};
+	QCOMPARE(readTokens(reader), expected);
+	QVERIFY(!reader.hasError());
+}
+
+void QJsonStreamReaderTest::tokensFromDevice()
+{
+	QByteArray data = R"({"values": [)";
+	for (int i = 0; i < 20000; ++i)
+		data += QByteArray::number(i) + (i + 1 < 20000 ? "," : "");
+	data += "]}";
+
+	QBuffer buffer(&data);
+	QVERIFY(buffer.open(QIODevice::ReadOnly));
+	QJsonStreamReader reader(&buffer);
+	QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+	QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+
+	// Values cross the chunk boundaries of the reader
+	const QJsonArray values = reader.readValue().toArray();
+	QCOMPARE(values.size(), 20000);
+	QCOMPARE(values.last().toInt(), 19999);
+	QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+	QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void QJsonStreamReaderTest::numbers_data()
+{
+	QTest::addColumn<QByteArray>("json");
+	QTest::addColumn<bool>("valid");
+	QTest::addColumn<double>("value");
+
+	QTest::newRow("zero") << QByteArray("[0]") << true << 0.0;
+	QTest::newRow("negative zero") << QByteArray("[-0]") << true << -0.0;
+	QTest::newRow("negative zero fraction") << QByteArray("[-0.0]") << true << -0.0;
+	QTest::newRow("integer") << QByteArray("[10]") << true << 10.0;
+	QTest::newRow("fraction") << QByteArray("[0.5]") << true << 0.5;
+	QTest::newRow("exponent") << QByteArray("[-1.5e3]") << true << -1500.0;
+	QTest::newRow("big integer") << QByteArray("[12345678901234567890]") << true << 12345678901234567890.0;
+	QTest::newRow("leading zero") << QByteArray("[01]") << false << 0.0;
+	QTest::newRow("negative leading zero") << QByteArray("[-01]") << false << 0.0;
+	QTest::newRow("double zero") << QByteArray("[00]") << false << 0.0;
+	QTest::newRow("missing fraction") << QByteArray("[1.]") << false << 0.0;
+	QTest::newRow("missing digits") << QByteArray("[-]") << false << 0.0;
+	QTest::newRow("plus sign") << QByteArray("[+1]") << false << 0.0;
+}
+
+void QJsonStreamReaderTest::numbers()
+{
+	QFETCH(QByteArray, json);
+	QFETCH(bool, valid);
+	QFETCH(double, value);
+
+	QJsonStreamReader reader(json);
+	QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+	const QJsonStreamReader::TokenType token = reader.readNext();
+	if (!valid)
+	{
+		QCOMPARE(token, QJsonStreamReader::Invalid);
+		QVERIFY(reader.hasError());
+		return;
+	}
+	QCOMPARE(token, QJsonStreamReader::Number);
+	QCOMPARE(reader.numberValue(), value);
+	QCOMPARE(std::signbit(reader.numberValue()), std::signbit(value));
+	QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+	QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void QJsonStreamReaderTest::skipValue_data()
+{
+	QTest::addColumn<QByteArray>("json");
+	QTest::addColumn<bool>("valid");
+
+	QTest::newRow("nested") << QByteArray(R"({"skip": {"a": [1, {"b": "]}"}]}, "x": 1})") << true;
+	QTest::newRow("scalar") << QByteArray(R"({"skip": "}", "x": 1})") << true;
+	QTest::newRow("array closed by brace") << QByteArray(R"({"skip": [1, 2}, "x": 1})") << false;
+	QTest::newRow("object closed by bracket") << QByteArray(R"({"skip": {"a": 1], "x": 1})") << false;
+	QTest::newRow("inner mismatch") << QByteArray(R"({"skip": {"a": [}]}, "x": 1})") << false;
+	QTest::newRow("unterminated") << QByteArray(R"({"skip": [1, 2)") << false;
+}
+
+void QJsonStreamReaderTest::skipValue()
+{
+	QFETCH(QByteArray, json);
+	QFETCH(bool, valid);
+
+	// Skipped from the Name token, without reading the value token
+	{
+		QJsonStreamReader reader(json);
+		QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+		QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+		QCOMPARE(reader.skipValue(), valid);
+		if (valid)
+		{
+			QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+			QCOMPARE(reader.name(), QStringLiteral("x"));
+		}
+	}
+
+	// Skipped from the StartObject or StartArray token
+	{
+		QJsonStreamReader reader(json);
+		QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+		QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+		reader.readNext();
+		QCOMPARE(reader.skipValue(), valid);
+		QCOMPARE(reader.hasError(), !valid);
+		if (valid)
+		{
+			QCOMPARE(reader.readNext(), QJsonStreamReader::Name);
+			QCOMPARE(reader.name(), QStringLiteral("x"));
+		}
+	}
+}
+
+void QJsonStreamReaderTest::streamImportMacros()
+{
+	QJsonStreamReader reader(QByteArray(R"({
+		"ignored": {"deep": [1, 2, {"x": 3}]},
+		"x": 42,
+		"name": "streamed",
+		"enabled": true,
+		"big": "9007199254740993",
+		"child": {"value": 7, "other": null},
+		"children": [{"value": 1}, 12, {"value": 2}],
+		"wrongType": "x"
+	})"));
+	QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+
+	Streamed streamed;
+	QVERIFY(streamed.jsonStreamRead(reader));
+	QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+
+	QCOMPARE(streamed.x, 42);
+	QCOMPARE(streamed.name, QStringLiteral("streamed"));
+	QCOMPARE(streamed.enabled, true);
+	QCOMPARE(streamed.big, Q_INT64_C(9007199254740993));
+	QCOMPARE(streamed.child.value, 7);
+	QCOMPARE(streamed.children, QList<int>({ 1, 2 }));
+}
+
+void QJsonStreamReaderTest::defaultStreamReadBuildOneObject()
+{
+	QJsonStreamReader reader(QByteArray(R"({"a": 1, "b": {"c": [true]}})"));
+	QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+
+	Buffered buffered;
+	QVERIFY(buffered.jsonStreamRead(reader));
+	QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+
+	QCOMPARE(buffered.reads, 1);
+	QCOMPARE(buffered.last.value(QStringLiteral("a")).toInt(), 1);
+	QCOMPARE(buffered.last.value(QStringLiteral("b")).toObject().value(QStringLiteral("c")).toArray().first().toBool(), true);
+}
+
+QTEST_GUILESS_MAIN(QJsonStreamReaderTest)
+#include "QJsonStreamReaderTest.moc"
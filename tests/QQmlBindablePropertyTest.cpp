@@ -0,0 +1,104 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <type_traits>
+
+#include <QSignalSpy>
+#include <QtTest>
+
+#include <QQmlBindablePropertyHelpers.h>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+class BindableRectangle : public QObject
+{
+	Q_OBJECT
+	QSM_BINDABLE_WRITABLE_PROPERTY_WDEFAULT(BindableRectangle, int, width, Width, 2)
+	QSM_BINDABLE_WRITABLE_PROPERTY_WDEFAULT(BindableRectangle, int, height, Height, 3)
+	QSM_BINDABLE_READONLY_PROPERTY(BindableRectangle, int, area, Area)
+	QSM_BINDABLE_WRITABLE_PROPERTY(BindableRectangle, QString, title, Title)
+
+public:
+	explicit BindableRectangle(QObject* parent = nullptr) : QObject(parent)
+	{
+		bindableArea().setBinding([this]() { return width() * height(); });
+	}
+};
+
+class QQmlBindablePropertyTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void defaults();
+	void setter();
+	void binding();
+	void signatures();
+};
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+void QQmlBindablePropertyTest::defaults()
+{
+	BindableRectangle rectangle;
+	QCOMPARE(rectangle.width(), 2);
+	QCOMPARE(rectangle.height(), 3);
+	QCOMPARE(rectangle.area(), 6);
+	QVERIFY(rectangle.title().isEmpty());
+	QCOMPARE(rectangle.property("width").toInt(), 2);
+}
+
+void QQmlBindablePropertyTest::setter()
+{
+	BindableRectangle rectangle;
+	QSignalSpy spy(&rectangle, &BindableRectangle::widthChanged);
+
+	QVERIFY(rectangle.setWidth(5));
+	QVERIFY(!rectangle.setWidth(5));
+	QCOMPARE(spy.count(), 1);
+	QCOMPARE(spy.first().first().toInt(), 5);
+
+	QVERIFY(rectangle.setTitle(QStringLiteral("rect")));
+	QCOMPARE(rectangle.title(), QStringLiteral("rect"));
+
+	QVERIFY(rectangle.resetWidth());
+	QCOMPARE(rectangle.width(), 2);
+}
+
+void QQmlBindablePropertyTest::binding()
+{
+	BindableRectangle rectangle;
+	rectangle.setWidth(4);
+	rectangle.setHeight(5);
+	QCOMPARE(rectangle.area(), 20);
+
+	// A write removes the binding, like a write from QML
+	rectangle.bindableWidth().setBinding([&rectangle]() { return rectangle.height() * 2; });
+	QCOMPARE(rectangle.width(), 10);
+	rectangle.setWidth(1);
+	rectangle.setHeight(7);
+	QCOMPARE(rectangle.width(), 1);
+	QCOMPARE(rectangle.area(), 7);
+}
+
+void QQmlBindablePropertyTest::signatures()
+{
+	static_assert(std::is_same<decltype(std::declval<BindableRectangle>().width()), int>::value, "Small types are returned by value");
+	static_assert(std::is_same<decltype(std::declval<BindableRectangle>().title()), const QString &>::value, "Large types are returned by const reference");
+
+	// A single setter per property, so its address can be taken
+	bool (BindableRectangle::*setter)(QString) = &BindableRectangle::setTitle;
+	BindableRectangle rectangle;
+	QVERIFY((rectangle.*setter)(QStringLiteral("title")));
+	QCOMPARE(rectangle.title(), QStringLiteral("title"));
+}
+
+QTEST_GUILESS_MAIN(QQmlBindablePropertyTest)
+#include "QQmlBindablePropertyTest.moc"
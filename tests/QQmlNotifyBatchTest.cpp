@@ -0,0 +1,156 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QSignalSpy>
+#include <QtTest>
+
+#include <QQmlAutoPropertyHelpers.h>
+#include <QQmlNotifyBatch.h>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+class Point : public QObject
+{
+	Q_OBJECT
+	QSM_WRITABLE_AUTO_PROPERTY(int, x, X)
+	QSM_WRITABLE_AUTO_PROPERTY(int, y, Y)
+	QSM_WRITABLE_AUTO_PROPERTY(QString, label, Label)
+};
+
+class QQmlNotifyBatchTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void emitOncePerProperty();
+	void nestedBatch();
+	void setterCalledDuringFlush();
+	void setterCalledDuringExplicitFlush();
+	void objectDeletedDuringFlush();
+};
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+void QQmlNotifyBatchTest::emitOncePerProperty()
+{
+	Point point;
+	QSignalSpy xSpy(&point, &Point::xChanged);
+	QSignalSpy ySpy(&point, &Point::yChanged);
+	QSignalSpy labelSpy(&point, &Point::labelChanged);
+
+	{
+		QQmlNotifyBatch batch(&point);
+		point.setX(12);
+		point.setY(13);
+		point.setX(14);
+		point.setLabel(QStringLiteral("a"));
+		point.setLabel(QStringLiteral("b"));
+		QCOMPARE(batch.pendingCount(), 3);
+		QCOMPARE(xSpy.count(), 0);
+		QCOMPARE(point.x(), 14);
+	}
+
+	QCOMPARE(xSpy.count(), 1);
+	QCOMPARE(xSpy.first().first().toInt(), 14);
+	QCOMPARE(ySpy.count(), 1);
+	QCOMPARE(ySpy.first().first().toInt(), 13);
+	QCOMPARE(labelSpy.count(), 1);
+	QCOMPARE(labelSpy.first().first().toString(), QStringLiteral("b"));
+
+	// Without batch, signals are emitted by the setter
+	point.setX(15);
+	QCOMPARE(xSpy.count(), 2);
+}
+
+void QQmlNotifyBatchTest::nestedBatch()
+{
+	Point point;
+	QSignalSpy xSpy(&point, &Point::xChanged);
+	QSignalSpy ySpy(&point, &Point::yChanged);
+
+	{
+		QQmlNotifyBatch outer(&point);
+		point.setX(1);
+		{
+			QQmlNotifyBatch inner(&point);
+			point.setX(2);
+			point.setY(3);
+			QCOMPARE(inner.pendingCount(), 0);
+		}
+		// The inner batch joined the outer one
+		QCOMPARE(xSpy.count(), 0);
+		QCOMPARE(ySpy.count(), 0);
+		QCOMPARE(outer.pendingCount(), 2);
+	}
+
+	QCOMPARE(xSpy.count(), 1);
+	QCOMPARE(xSpy.first().first().toInt(), 2);
+	QCOMPARE(ySpy.count(), 1);
+	QCOMPARE(ySpy.first().first().toInt(), 3);
+}
+
+void QQmlNotifyBatchTest::setterCalledDuringFlush()
+{
+	Point point;
+	QSignalSpy ySpy(&point, &Point::yChanged);
+	QObject::connect(&point, &Point::xChanged, [&point](const int x) { point.setY(x * 2); });
+
+	{
+		QQmlNotifyBatch batch(&point);
+		point.setX(5);
+		point.setY(1);
+	}
+
+	// The batch is closed while flushing : the slot emits y at once, then the deferred signal carry the final value
+	QCOMPARE(point.y(), 10);
+	QCOMPARE(ySpy.count(), 2);
+	QCOMPARE(ySpy.last().first().toInt(), 10);
+}
+
+void QQmlNotifyBatchTest::setterCalledDuringExplicitFlush()
+{
+	Point point;
+	QSignalSpy ySpy(&point, &Point::yChanged);
+	QObject::connect(&point, &Point::xChanged, [&point](const int x) { point.setY(x * 2); });
+
+	QQmlNotifyBatch batch(&point);
+	point.setX(5);
+	batch.flush();
+
+	// The batch is still open, the setter called by the slot is deferred again
+	QCOMPARE(ySpy.count(), 0);
+	QCOMPARE(batch.pendingCount(), 1);
+	batch.flush();
+	QCOMPARE(ySpy.count(), 1);
+	QCOMPARE(ySpy.first().first().toInt(), 10);
+}
+
+void QQmlNotifyBatchTest::objectDeletedDuringFlush()
+{
+	Point* point = new Point;
+	QPointer<Point> guard(point);
+	int xEmitted = 0;
+	int yEmitted = 0;
+	QObject::connect(point, &Point::xChanged, [&xEmitted, point]() { ++xEmitted; delete point; });
+	QObject::connect(point, &Point::yChanged, [&yEmitted]() { ++yEmitted; });
+
+	{
+		QQmlNotifyBatch batch(point);
+		point->setX(1);
+		point->setY(2);
+	}
+
+	QVERIFY(guard.isNull());
+	QCOMPARE(xEmitted, 1);
+	QCOMPARE(yEmitted, 0);
+}
+
+QTEST_GUILESS_MAIN(QQmlNotifyBatchTest)
+#include "QQmlNotifyBatchTest.moc"
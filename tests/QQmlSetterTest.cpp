@@ -0,0 +1,159 @@
+// ─────────────────────────────────────────────────────────────
+//					INCLUDE
+// ─────────────────────────────────────────────────────────────
+
+#include <QSignalSpy>
+#include <QtTest>
+
+#include <QQmlAutoPropertyHelpers.h>
+#include <QQmlConstRefPropertyHelpers.h>
+
+// ─────────────────────────────────────────────────────────────
+//					DECLARATION
+// ─────────────────────────────────────────────────────────────
+
+QSUPERMACROS_USING_NAMESPACE;
+
+/** Value that count its copies, too big to be passed by value by CheapestType */
+struct Counted
+{
+	Counted(const int v = 0) : value(v) {}
+	Counted(const Counted& other) : value(other.value) { ++copies; }
+	Counted(Counted&& other) : value(other.value) { ++moves; }
+	Counted& operator=(const Counted& other) { value = other.value; ++copies; return *this; }
+	Counted& operator=(Counted&& other) { value = other.value; ++moves; return *this; }
+	bool operator==(const Counted& other) const { return value == other.value; }
+	bool operator!=(const Counted& other) const { return value != other.value; }
+
+	int value;
+	static int copies;
+	static int moves;
+	static void reset() { copies = 0; moves = 0; }
+};
+
+int Counted::copies = 0;
+int Counted::moves = 0;
+
+Q_DECLARE_METATYPE(Counted)
+
+class Setters : public QObject
+{
+	Q_OBJECT
+	QSM_WRITABLE_AUTO_PROPERTY(QString, text, Text)
+	QSM_WRITABLE_AUTO_PROPERTY(int, number, Number)
+	QSM_WRITABLE_AUTO_PROPERTY(Counted, autoValue, AutoValue)
+	QSM_WRITABLE_CSTREF_PROPERTY(Counted, cstrefValue, CstrefValue)
+};
+
+class QQmlSetterTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void autoLvalue();
+	void autoRvalue();
+	void cstrefLvalue();
+	void cstrefRvalue();
+	void signatures();
+};
+
+// ─────────────────────────────────────────────────────────────
+//					FUNCTIONS
+// ─────────────────────────────────────────────────────────────
+
+void QQmlSetterTest::autoLvalue()
+{
+	Setters setters;
+	QSignalSpy spy(&setters, &Setters::textChanged);
+
+	const QString text = QStringLiteral("text");
+	QVERIFY(setters.setText(text));
+	QVERIFY(!setters.setText(text));
+	QCOMPARE(setters.text(), text);
+	QCOMPARE(spy.count(), 1);
+	QCOMPARE(spy.first().first().toString(), text);
+
+	const Counted value(1);
+	Counted::reset();
+	QVERIFY(setters.setAutoValue(value));
+	QCOMPARE(setters.autoValue().value, 1);
+	// The sink parameter is copied even when the value doesn't change
+	Counted::reset();
+	QVERIFY(!setters.setAutoValue(value));
+	QCOMPARE(Counted::copies, 1);
+}
+
+void QQmlSetterTest::autoRvalue()
+{
+	Setters setters;
+	QSignalSpy spy(&setters, &Setters::textChanged);
+
+	QString text = QStringLiteral("moved");
+	QVERIFY(setters.setText(std::move(text)));
+	QCOMPARE(setters.text(), QStringLiteral("moved"));
+	QCOMPARE(spy.count(), 1);
+
+	QVERIFY(setters.setAutoValue(Counted(1)));
+	Counted::reset();
+	QVERIFY(!setters.setAutoValue(Counted(1)));
+	QCOMPARE(Counted::copies, 0);
+	QVERIFY(setters.setAutoValue(Counted(2)));
+	QCOMPARE(setters.autoValue().value, 2);
+	QVERIFY(Counted::moves > 0);
+}
+
+void QQmlSetterTest::cstrefLvalue()
+{
+	Setters setters;
+	// Counted without QSignalSpy, that would copy the arguments
+	int emitted = 0;
+	QObject::connect(&setters, &Setters::cstrefValueChanged, [&emitted](const Counted&) { ++emitted; });
+
+	const Counted value(3);
+	Counted::reset();
+	QVERIFY(setters.setCstrefValue(value));
+	// Copied into the parameter, then moved into the attribute. The signal pass a reference
+	QCOMPARE(Counted::copies, 1);
+	QCOMPARE(setters.cstrefValue().value, 3);
+	QCOMPARE(emitted, 1);
+
+	Counted::reset();
+	QVERIFY(!setters.setCstrefValue(value));
+	QCOMPARE(Counted::copies, 1);
+	QCOMPARE(emitted, 1);
+}
+
+void QQmlSetterTest::cstrefRvalue()
+{
+	Setters setters;
+	int emitted = 0;
+	QObject::connect(&setters, &Setters::cstrefValueChanged, [&emitted](const Counted&) { ++emitted; });
+
+	Counted::reset();
+	QVERIFY(setters.setCstrefValue(Counted(4)));
+	QCOMPARE(Counted::copies, 0);
+	QCOMPARE(setters.cstrefValue().value, 4);
+	QCOMPARE(emitted, 1);
+
+	Counted::reset();
+	QVERIFY(!setters.setCstrefValue(Counted(4)));
+	QCOMPARE(Counted::copies, 0);
+	QCOMPARE(emitted, 1);
+}
+
+void QQmlSetterTest::signatures()
+{
+	// A single setter per property, so its address can be taken without a cast
+	auto textSetter = &Setters::setText;
+	auto numberSetter = &Setters::setNumber;
+	static_assert(std::is_same<decltype(textSetter), bool (Setters::*)(QString)>::value, "Large types are taken by value");
+	static_assert(std::is_same<decltype(numberSetter), bool (Setters::*)(int)>::value, "Small types are taken by value");
+
+	Setters setters;
+	QVERIFY((setters.*textSetter)(QStringLiteral("text")));
+	QVERIFY((setters.*numberSetter)(2));
+	QCOMPARE(setters.number(), 2);
+}
+
+QTEST_GUILESS_MAIN(QQmlSetterTest)
+#include "QQmlSetterTest.moc"